@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <raylib.h>
+
+#include "asset_loader.h"
+
+// Sprite names (see assets.c) and the PNG each one comes from when there is
+// no pack. Largest first, so the long decodes start before the short ones.
+static const struct {
+    const char *name;
+    const char *path;
+} png_sprites[] = {
+    {"background", "img/background.png"},
+    {"game_over", "img/Game Over.png"},
+    {"floor", "img/floor.png"},
+    {"sword", "img/sward.png"},
+    {"arrow", "img/arrow4.png"},
+    {"jumping", "img/jumping.png"},
+    {"walk2", "img/walk2.png"},
+    {"platform1", "img/platform1.png"},
+    {"platform2", "img/platform2.png"},
+    {"standing", "img/standing.png"},
+    {"walk1", "img/walk1.png"},
+    {"crouch_left", "img/crouch1.png"},
+    {"crouch_right", "img/crouch2.png"},
+};
+static const int png_sprite_count = sizeof(png_sprites) / sizeof(png_sprites[0]);
+
+static AssetJob *add_job(AssetLoader *loader, AssetJobKind kind, const char *name, const char *path) {
+    AssetJob *job = &loader->jobs[loader->job_count++];
+    *job = (AssetJob){.kind = kind, .name = name, .path = path};
+    return job;
+}
+
+// Read one byte per memory page so the pages are resident before upload
+static void touch_pages(Image image) {
+    const volatile unsigned char *bytes = (const volatile unsigned char *)image.data;
+    size_t size = (size_t)image.width * image.height * 4;
+    unsigned char sum = 0;
+    for (size_t i = 0; i < size; i += 4096) {
+        sum += bytes[i];
+    }
+    (void)sum;
+}
+
+static void run_job(AssetLoader *loader, AssetJob *job) {
+    double start = GetTime();
+    switch (job->kind) {
+    case ASSET_JOB_IMAGE:
+        job->image = LoadImage(job->path);
+        if (job->image.data == NULL) {
+            job->failed = true;
+        } else {
+            ImageFormat(&job->image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+        break;
+    case ASSET_JOB_PACK_PAGE:
+        job->image = asset_pack_page(&loader->pack, job->page);
+        touch_pages(job->image);
+        break;
+    case ASSET_JOB_MUSIC:
+        *job->music = LoadMusicStream(job->path);
+        job->failed = job->music->stream.buffer == NULL;
+        break;
+    case ASSET_JOB_SOUND:
+        *job->sound = LoadSound(job->path);
+        job->failed = job->sound->stream.buffer == NULL;
+        break;
+    }
+    job->decode_seconds = GetTime() - start;
+}
+
+static void *worker_main(void *arg) {
+    AssetLoader *loader = (AssetLoader *)arg;
+    for (;;) {
+        int index = __atomic_fetch_add(&loader->next_job, 1, __ATOMIC_RELAXED);
+        if (index >= loader->job_count) {
+            return NULL;
+        }
+        run_job(loader, &loader->jobs[index]);
+
+        pthread_mutex_lock(&loader->lock);
+        loader->ready[loader->ready_count++] = index;
+        pthread_mutex_unlock(&loader->lock);
+    }
+}
+
+// Queue every asset and start the workers. Uses assets.pak when it is
+// complete, the PNGs in img/ otherwise. The audio device must be open.
+void asset_loader_start(AssetLoader *loader, GameAssets *assets) {
+    memset(loader, 0, sizeof(*loader));
+    memset(assets, 0, sizeof(*assets));
+    loader->assets = assets;
+    loader->start = GetTime();
+    pthread_mutex_init(&loader->lock, NULL);
+
+    add_job(loader, ASSET_JOB_MUSIC, "background_music.mp3", "img/background_music.mp3")->music = &assets->background_music;
+    add_job(loader, ASSET_JOB_SOUND, "gameover1.mp3", "img/gameover1.mp3")->sound = &assets->gameover_sound;
+
+    // A pack with missing sprites is not worth uploading; binding against
+    // placeholder textures finds that out before anything is queued
+    loader->use_pack = asset_pack_open(&loader->pack, ASSET_PACK_PATH);
+    if (loader->use_pack && !asset_pack_bind(assets, &loader->pack, loader->page_textures)) {
+        TraceLog(LOG_WARNING, "ASSETS: %s is missing sprites, falling back to img/", ASSET_PACK_PATH);
+        asset_pack_close(&loader->pack);
+        loader->use_pack = false;
+    }
+
+    if (loader->use_pack) {
+        for (int p = 0; p < loader->pack.page_count; p++) {
+            add_job(loader, ASSET_JOB_PACK_PAGE, "pack page", ASSET_PACK_PATH)->page = p;
+        }
+    } else {
+        for (int i = 0; i < png_sprite_count; i++) {
+            add_job(loader, ASSET_JOB_IMAGE, png_sprites[i].name, png_sprites[i].path);
+        }
+    }
+
+    for (int t = 0; t < ASSET_LOADER_THREADS && t < loader->job_count; t++) {
+        if (pthread_create(&loader->threads[loader->thread_count], NULL, worker_main, loader) == 0) {
+            loader->thread_count++;
+        }
+    }
+    // No threads at all: do the work here, the progress screen just stays blank
+    if (loader->thread_count == 0) {
+        worker_main(loader);
+    }
+}
+
+// Upload the images finished since the last call, spending about
+// upload_budget seconds (at least one upload). Returns true once every
+// asset is in.
+bool asset_loader_update(AssetLoader *loader, double upload_budget) {
+    int ready[MAX_ASSET_JOBS];
+    pthread_mutex_lock(&loader->lock);
+    int ready_count = loader->ready_count;
+    memcpy(ready, loader->ready, sizeof(int) * ready_count);
+    pthread_mutex_unlock(&loader->lock);
+
+    GameAssets *assets = loader->assets;
+    double budget_end = GetTime() + upload_budget;
+    while (loader->handled < ready_count && (loader->handled == 0 || GetTime() < budget_end)) {
+        AssetJob *job = &loader->jobs[ready[loader->handled++]];
+        if (job->failed) {
+            TraceLog(LOG_WARNING, "ASSETS: failed to load %s", job->path);
+        } else if (job->kind == ASSET_JOB_IMAGE || job->kind == ASSET_JOB_PACK_PAGE) {
+            double start = GetTime();
+            Sprite sprite = asset_add_texture(assets, LoadTextureFromImage(job->image));
+            if (job->kind == ASSET_JOB_PACK_PAGE) {
+                loader->page_textures[job->page] = sprite.texture;
+            } else {
+                asset_bind_sprite(assets, job->name, sprite);
+                UnloadImage(job->image);
+            }
+            job->image = (Image){0};
+            job->upload_seconds = GetTime() - start;
+        }
+        job->done_at = GetTime() - loader->start;
+    }
+
+    if (loader->handled < loader->job_count) {
+        return false;
+    }
+    if (loader->use_pack && loader->pack.data != NULL) {
+        asset_pack_bind(assets, &loader->pack, loader->page_textures);
+        asset_pack_close(&loader->pack);
+    }
+    assets->source = loader->use_pack ? "pack" : "png";
+    assets->load_seconds = GetTime() - loader->start;
+    return true;
+}
+
+// Fraction of assets finished, 0..1, for the progress screen
+float asset_loader_progress(const AssetLoader *loader) {
+    return loader->job_count > 0 ? (float)loader->handled / loader->job_count : 1.0f;
+}
+
+// Wait for the workers. Safe to call before loading is done, e.g. when the
+// window is closed on the progress screen; images never uploaded are freed.
+void asset_loader_finish(AssetLoader *loader) {
+    if (loader->joined) {
+        return;
+    }
+    for (int t = 0; t < loader->thread_count; t++) {
+        pthread_join(loader->threads[t], NULL);
+    }
+    loader->joined = true;
+
+    for (int i = 0; i < loader->job_count; i++) {
+        AssetJob *job = &loader->jobs[i];
+        if (job->kind == ASSET_JOB_IMAGE && job->image.data != NULL) {
+            UnloadImage(job->image);
+            job->image = (Image){0};
+        }
+    }
+    asset_pack_close(&loader->pack);
+    pthread_mutex_destroy(&loader->lock);
+}
+
+// Per-asset timings, in the order the assets were finished
+void asset_loader_report(const AssetLoader *loader) {
+    printf("%-22s %10s %10s %10s\n", "asset", "decode ms", "upload ms", "done at ms");
+    for (int i = 0; i < loader->handled; i++) {
+        const AssetJob *job = &loader->jobs[loader->ready[i]];
+        const char *name = job->kind == ASSET_JOB_PACK_PAGE ? TextFormat("pack page %d", job->page) : job->name;
+        printf("%-22s %10.2f %10.2f %10.2f%s\n", name, job->decode_seconds * 1000.0, job->upload_seconds * 1000.0,
+               job->done_at * 1000.0, job->failed ? "  FAILED" : "");
+    }
+}
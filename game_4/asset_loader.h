@@ -0,0 +1,68 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+// Threaded startup loading. Worker threads decode the PNGs (or fault in the
+// pages of assets.pak), open the music stream and decode short clips to PCM;
+// the main thread uploads finished images to the GPU, since only the thread
+// that owns the OpenGL context may, and draws a progress screen until
+// everything is in.
+
+#include <stdbool.h>
+#include <pthread.h>
+#include <raylib.h>
+#include "assets.h"
+
+#define ASSET_LOADER_THREADS 4
+#define MAX_ASSET_JOBS 32
+
+typedef enum {
+    ASSET_JOB_IMAGE,     // Decode a PNG
+    ASSET_JOB_PACK_PAGE, // Touch a mapped pack page so upload does not page fault
+    ASSET_JOB_MUSIC,     // Open a music stream
+    ASSET_JOB_SOUND,     // Decode a short clip to PCM
+} AssetJobKind;
+
+typedef struct {
+    const char *name; // Sprite name for images, file name otherwise
+    const char *path;
+    AssetJobKind kind;
+    int page;         // ASSET_JOB_PACK_PAGE
+    Music *music;     // ASSET_JOB_MUSIC: where the opened stream goes
+    Sound *sound;     // ASSET_JOB_SOUND: where the decoded clip goes
+
+    Image image;      // Pixels waiting for upload
+    bool failed;
+    double decode_seconds; // Worker time
+    double upload_seconds; // Main thread time in LoadTextureFromImage
+    double done_at;        // Seconds after asset_loader_start() the job was finished
+} AssetJob;
+
+typedef struct {
+    GameAssets *assets;
+    AssetPack pack;
+    bool use_pack;
+    Texture2D page_textures[MAX_ASSET_TEXTURES];
+
+    AssetJob jobs[MAX_ASSET_JOBS];
+    int job_count;
+    int next_job; // Next job a worker takes, updated atomically
+
+    // Jobs the workers are done with, in completion order
+    pthread_mutex_t lock;
+    int ready[MAX_ASSET_JOBS];
+    int ready_count;
+
+    int handled; // Ready jobs the main thread has finished, main thread only
+    pthread_t threads[ASSET_LOADER_THREADS];
+    int thread_count;
+    bool joined;
+    double start;
+} AssetLoader;
+
+void asset_loader_start(AssetLoader *loader, GameAssets *assets);
+bool asset_loader_update(AssetLoader *loader, double upload_budget);
+float asset_loader_progress(const AssetLoader *loader);
+void asset_loader_finish(AssetLoader *loader);
+void asset_loader_report(const AssetLoader *loader);
+
+#endif
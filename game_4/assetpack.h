@@ -0,0 +1,46 @@
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+// On-disk layout of assets.pak, written by tools/pack.c and memory-mapped by
+// assets.c. All integers are little endian. The file is:
+//
+//   PackHeader
+//   PackPage[page_count]
+//   PackSprite[sprite_count]
+//   page pixels, RGBA8, each starting at a PACK_ALIGN boundary
+//
+// Page 0 is an atlas of the small sprites; large images get a page each.
+// Left-facing character poses are not stored: they are drawn by mirroring
+// the right-facing sprite's source rectangle.
+
+#include <stdint.h>
+
+#define PACK_MAGIC "SJPK"
+#define PACK_VERSION 1
+#define PACK_ALIGN 64
+#define PACK_NAME_LENGTH 24
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t page_count;
+    uint32_t sprite_count;
+} PackHeader;
+
+typedef struct {
+    uint32_t width;
+    uint32_t height;
+    uint32_t offset; // Start of the RGBA8 pixels from the start of the file
+    uint32_t size;   // width * height * 4
+} PackPage;
+
+typedef struct {
+    char name[PACK_NAME_LENGTH];
+    uint32_t page;
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} PackSprite;
+
+#endif
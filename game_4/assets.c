@@ -0,0 +1,306 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <raylib.h>
+
+#ifdef _WIN32
+#define ASSETS_MMAP 0
+#else
+#define ASSETS_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "assets.h"
+#include "assetpack.h"
+
+#define NO_MIRROR ((size_t)-1)
+
+// Where each packed sprite goes in GameAssets, and where its mirrored copy goes
+typedef struct {
+    const char *name;
+    size_t field;
+    size_t mirror_field;
+} SpriteBinding;
+
+static const SpriteBinding sprite_bindings[] = {
+    {"background", offsetof(GameAssets, background), NO_MIRROR},
+    {"arrow", offsetof(GameAssets, projectiles[PROJECTILE_ARROW]), NO_MIRROR},
+    {"sword", offsetof(GameAssets, projectiles[PROJECTILE_SWORD]), NO_MIRROR},
+    {"platform1", offsetof(GameAssets, platform1), NO_MIRROR},
+    {"platform2", offsetof(GameAssets, platform2), NO_MIRROR},
+    {"floor", offsetof(GameAssets, floor_piece), NO_MIRROR},
+    {"standing", offsetof(GameAssets, character_standing_right), offsetof(GameAssets, character_standing_left)},
+    {"jumping", offsetof(GameAssets, character_jumping_right), offsetof(GameAssets, character_jumping_left)},
+    {"walk1", offsetof(GameAssets, character_walk1_right), offsetof(GameAssets, character_walk1_left)},
+    {"walk2", offsetof(GameAssets, character_walk2_right), offsetof(GameAssets, character_walk2_left)},
+    {"crouch_left", offsetof(GameAssets, character_crouching_left), NO_MIRROR},
+    {"crouch_right", offsetof(GameAssets, character_crouching_right), NO_MIRROR},
+    {"game_over", offsetof(GameAssets, game_over), NO_MIRROR},
+};
+static const int sprite_binding_count = sizeof(sprite_bindings) / sizeof(sprite_bindings[0]);
+
+static Sprite *sprite_at(GameAssets *assets, size_t field) {
+    return (Sprite *)((char *)assets + field);
+}
+
+// Remember an uploaded texture and return a sprite covering all of it
+Sprite asset_add_texture(GameAssets *assets, Texture2D texture) {
+    if (assets->texture_count < MAX_ASSET_TEXTURES) {
+        assets->textures[assets->texture_count++] = texture;
+    }
+    assets->texture_bytes += (long)texture.width * texture.height * 4;
+    return (Sprite){texture, (Rectangle){0, 0, texture.width, texture.height}};
+}
+
+// Store a sprite under its pack name, and its mirrored copy if it has one.
+// Returns false for an unknown name.
+bool asset_bind_sprite(GameAssets *assets, const char *name, Sprite sprite) {
+    for (int b = 0; b < sprite_binding_count; b++) {
+        const SpriteBinding *binding = &sprite_bindings[b];
+        if (strncmp(name, binding->name, PACK_NAME_LENGTH) != 0) {
+            continue;
+        }
+        *sprite_at(assets, binding->field) = sprite;
+        if (binding->mirror_field != NO_MIRROR) {
+            sprite.source.width = -sprite.source.width;
+            *sprite_at(assets, binding->mirror_field) = sprite;
+        }
+        return true;
+    }
+    return false;
+}
+
+// Map the whole file read-only. Returns NULL if it cannot be read.
+static unsigned char *map_file(const char *path, size_t *size) {
+#if ASSETS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+    *size = info.st_size;
+    return (unsigned char *)data;
+#else
+    int data_size = 0;
+    unsigned char *data = LoadFileData(path, &data_size);
+    *size = data_size;
+    return data;
+#endif
+}
+
+static void unmap_file(unsigned char *data, size_t size) {
+#if ASSETS_MMAP
+    munmap(data, size);
+#else
+    (void)size;
+    UnloadFileData(data);
+#endif
+}
+
+static const PackHeader *pack_header(const AssetPack *pack) {
+    return (const PackHeader *)pack->data;
+}
+
+static const PackPage *pack_pages(const AssetPack *pack) {
+    return (const PackPage *)(pack->data + sizeof(PackHeader));
+}
+
+// Map a pack and check its header and page table
+bool asset_pack_open(AssetPack *pack, const char *path) {
+    pack->size = 0;
+    pack->data = map_file(path, &pack->size);
+    if (pack->data == NULL) {
+        return false;
+    }
+
+    const PackHeader *header = pack_header(pack);
+    bool valid = pack->size >= sizeof(PackHeader) && memcmp(header->magic, PACK_MAGIC, 4) == 0 &&
+                 header->version == PACK_VERSION && header->page_count <= MAX_ASSET_TEXTURES &&
+                 sizeof(PackHeader) + header->page_count * sizeof(PackPage) +
+                 header->sprite_count * sizeof(PackSprite) <= pack->size;
+    const PackPage *pages = pack_pages(pack);
+    for (uint32_t p = 0; valid && p < header->page_count; p++) {
+        valid = (size_t)pages[p].offset + pages[p].size <= pack->size &&
+                pages[p].size == pages[p].width * pages[p].height * 4;
+    }
+    if (!valid) {
+        TraceLog(LOG_WARNING, "ASSETS: %s is not a version %d asset pack", path, PACK_VERSION);
+        asset_pack_close(pack);
+        return false;
+    }
+    pack->page_count = header->page_count;
+    return true;
+}
+
+// A page's pixels, pointing into the mapping: valid until asset_pack_close()
+Image asset_pack_page(const AssetPack *pack, int page) {
+    const PackPage *info = &pack_pages(pack)[page];
+    return (Image){
+        .data = pack->data + info->offset,
+        .width = info->width,
+        .height = info->height,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+    };
+}
+
+// Point every sprite at its rectangle in the uploaded pages.
+// Returns false if the pack lacks a sprite the game draws.
+bool asset_pack_bind(GameAssets *assets, const AssetPack *pack, const Texture2D page_textures[]) {
+    const PackHeader *header = pack_header(pack);
+    const PackSprite *sprites = (const PackSprite *)(pack_pages(pack) + header->page_count);
+    int bound = 0;
+    for (uint32_t s = 0; s < header->sprite_count; s++) {
+        const PackSprite *sprite = &sprites[s];
+        if (sprite->page >= header->page_count) {
+            continue;
+        }
+        Rectangle source = {sprite->x, sprite->y, sprite->width, sprite->height};
+        bound += asset_bind_sprite(assets, sprite->name, (Sprite){page_textures[sprite->page], source});
+    }
+    return bound == sprite_binding_count;
+}
+
+void asset_pack_close(AssetPack *pack) {
+    if (pack->data != NULL) {
+        unmap_file(pack->data, pack->size);
+        pack->data = NULL;
+    }
+}
+
+// Upload the pack's pages straight from the mapped file, no image decoding
+bool load_assets_pack(GameAssets *assets, const char *path) {
+    double start = GetTime();
+    memset(assets, 0, sizeof(*assets));
+
+    AssetPack pack;
+    if (!asset_pack_open(&pack, path)) {
+        return false;
+    }
+
+    Texture2D page_textures[MAX_ASSET_TEXTURES];
+    for (int p = 0; p < pack.page_count; p++) {
+        page_textures[p] = asset_add_texture(assets, LoadTextureFromImage(asset_pack_page(&pack, p))).texture;
+    }
+    bool complete = asset_pack_bind(assets, &pack, page_textures);
+    asset_pack_close(&pack);
+
+    if (!complete) {
+        TraceLog(LOG_WARNING, "ASSETS: %s is missing sprites, falling back to img/", path);
+        unload_assets(assets);
+        return false;
+    }
+
+    assets->source = "pack";
+    assets->load_seconds = GetTime() - start;
+    return true;
+}
+
+void load_assets_png(GameAssets *assets) {
+    double start = GetTime();
+    memset(assets, 0, sizeof(*assets));
+
+    // Background Image
+    assets->background = asset_add_texture(assets, LoadTexture("img/background.png"));
+
+    // Load the arrow texture
+    assets->projectiles[PROJECTILE_ARROW] = asset_add_texture(assets, LoadTexture("img/arrow4.png"));
+
+    // Load the sword texture
+    assets->projectiles[PROJECTILE_SWORD] = asset_add_texture(assets, LoadTexture("img/sward.png"));
+
+    // Platforms1
+    Image platform1_img = LoadImage("img/platform1.png");
+    assets->platform1 = asset_add_texture(assets, LoadTextureFromImage(platform1_img));
+    UnloadImage(platform1_img);
+
+    // Platforms2
+    Image platform2_img = LoadImage("img/platform2.png");
+    assets->platform2 = asset_add_texture(assets, LoadTextureFromImage(platform2_img));
+    UnloadImage(platform2_img);
+
+    // Floor (Ground)
+    Image floor_img = LoadImage("img/floor.png");
+    assets->floor_piece = asset_add_texture(assets, LoadTextureFromImage(floor_img));
+    UnloadImage(floor_img);
+
+    // Character standing
+    Image character_standing = LoadImage("img/standing.png");
+    assets->character_standing_right = asset_add_texture(assets, LoadTextureFromImage(character_standing));
+    ImageFlipHorizontal(&character_standing);
+    assets->character_standing_left = asset_add_texture(assets, LoadTextureFromImage(character_standing));
+    UnloadImage(character_standing);
+
+    // Character Jumping
+    Image character_jumping = LoadImage("img/jumping.png");
+    assets->character_jumping_right = asset_add_texture(assets, LoadTextureFromImage(character_jumping));
+    ImageFlipHorizontal(&character_jumping);
+    assets->character_jumping_left = asset_add_texture(assets, LoadTextureFromImage(character_jumping));
+    UnloadImage(character_jumping);
+
+    // Character walking
+    // Walk 1
+    Image character_walk1 = LoadImage("img/walk1.png");
+    assets->character_walk1_right = asset_add_texture(assets, LoadTextureFromImage(character_walk1));
+    ImageFlipHorizontal(&character_walk1);
+    assets->character_walk1_left = asset_add_texture(assets, LoadTextureFromImage(character_walk1));
+    UnloadImage(character_walk1);
+
+    // Walk 2
+    Image character_walk2 = LoadImage("img/walk2.png");
+    assets->character_walk2_right = asset_add_texture(assets, LoadTextureFromImage(character_walk2));
+    ImageFlipHorizontal(&character_walk2);
+    assets->character_walk2_left = asset_add_texture(assets, LoadTextureFromImage(character_walk2));
+    UnloadImage(character_walk2);
+
+    // Character crouching
+    Image character_crouching_left_img = LoadImage("img/crouch1.png");
+    assets->character_crouching_left = asset_add_texture(assets, LoadTextureFromImage(character_crouching_left_img));
+    UnloadImage(character_crouching_left_img);
+
+    Image character_crouching_right_img = LoadImage("img/crouch2.png");
+    assets->character_crouching_right = asset_add_texture(assets, LoadTextureFromImage(character_crouching_right_img));
+    UnloadImage(character_crouching_right_img);
+
+    // Load the game over texture
+    assets->game_over = asset_add_texture(assets, LoadTexture("img/Game Over.png"));
+
+    assets->source = "png";
+    assets->load_seconds = GetTime() - start;
+}
+
+void unload_assets(GameAssets *assets) {
+    for (int i = 0; i < assets->texture_count; i++) {
+        UnloadTexture(assets->textures[i]);
+    }
+    assets->texture_count = 0;
+    assets->texture_bytes = 0;
+
+    if (assets->background_music.stream.buffer != NULL) {
+        UnloadMusicStream(assets->background_music);
+    }
+    if (assets->gameover_sound.stream.buffer != NULL) {
+        UnloadSound(assets->gameover_sound);
+    }
+    assets->background_music = (Music){0};
+    assets->gameover_sound = (Sound){0};
+}
+
+void print_asset_report(const GameAssets *assets) {
+    printf("assets: %-4s %2d textures, %6.1f MB texture memory, %7.1f ms to load\n", assets->source,
+           assets->texture_count, assets->texture_bytes / (1024.0 * 1024.0), assets->load_seconds * 1000.0);
+}
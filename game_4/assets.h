@@ -0,0 +1,73 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// Sprites and music the game plays. Sprites come from the prebaked assets.pak
+// (see assetpack.h and tools/pack.c) when it exists, or from the PNGs in img/.
+// The game loads them with asset_loader.h; the synchronous loaders below are
+// kept for --asset-report comparisons.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <raylib.h>
+#include "sim.h"
+
+#define ASSET_PACK_PATH "assets.pak"
+#define MAX_ASSET_TEXTURES 24
+
+// A picture inside a texture. A negative source width draws it mirrored.
+typedef struct {
+    Texture2D texture;
+    Rectangle source;
+} Sprite;
+
+typedef struct {
+    Sprite background;
+    Sprite projectiles[PROJECTILE_KIND_COUNT]; // Indexed by ProjectileKind
+    Sprite platform1;
+    Sprite platform2;
+    Sprite floor_piece;
+    Sprite character_standing_right;
+    Sprite character_standing_left;
+    Sprite character_jumping_right;
+    Sprite character_jumping_left;
+    Sprite character_walk1_right;
+    Sprite character_walk1_left;
+    Sprite character_walk2_right;
+    Sprite character_walk2_left;
+    Sprite character_crouching_right;
+    Sprite character_crouching_left;
+    Sprite game_over;
+
+    // Only opened by the threaded loader; zero otherwise
+    Music background_music; // Streamed
+    Sound gameover_sound;   // Short, decoded to PCM up front
+
+    // Every texture uploaded, for unloading and the startup report
+    Texture2D textures[MAX_ASSET_TEXTURES];
+    int texture_count;
+    long texture_bytes;
+    double load_seconds;
+    const char *source; // "pack" or "png"
+} GameAssets;
+
+// Memory-mapped assets.pak, see assetpack.h
+typedef struct {
+    unsigned char *data;
+    size_t size;
+    int page_count;
+} AssetPack;
+
+bool load_assets_pack(GameAssets *assets, const char *path);
+void load_assets_png(GameAssets *assets);
+void unload_assets(GameAssets *assets);
+void print_asset_report(const GameAssets *assets);
+
+// Building blocks shared by the loaders
+Sprite asset_add_texture(GameAssets *assets, Texture2D texture);
+bool asset_bind_sprite(GameAssets *assets, const char *name, Sprite sprite);
+bool asset_pack_open(AssetPack *pack, const char *path);
+Image asset_pack_page(const AssetPack *pack, int page);
+bool asset_pack_bind(GameAssets *assets, const AssetPack *pack, const Texture2D page_textures[]);
+void asset_pack_close(AssetPack *pack);
+
+#endif
@@ -0,0 +1,114 @@
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <raylib.h>
+
+#include "audio.h"
+#include "profiler.h"
+
+// Take the next command off the queue. Audio thread only.
+static bool take_command(AudioThread *audio, AudioCommand *command) {
+    uint32_t tail = audio->tail;
+    if (tail == __atomic_load_n(&audio->head, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *command = audio->queue[tail & (AUDIO_QUEUE_SIZE - 1)];
+    __atomic_store_n(&audio->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Returns false on AUDIO_QUIT
+static bool run_command(AudioThread *audio, AudioCommand command) {
+    switch (command.type) {
+    case AUDIO_PLAY_MUSIC:
+        PlayMusicStream(audio->music);
+        audio->music_playing = true;
+        break;
+    case AUDIO_STOP_MUSIC:
+        StopMusicStream(audio->music);
+        audio->music_playing = false;
+        break;
+    case AUDIO_MUSIC_VOLUME:
+        SetMusicVolume(audio->music, command.value);
+        break;
+    case AUDIO_PLAY_SOUND:
+        PlaySound(audio->sound);
+        audio->sound_looping = command.value != 0;
+        break;
+    case AUDIO_STOP_SOUND:
+        StopSound(audio->sound);
+        audio->sound_looping = false;
+        break;
+    case AUDIO_SOUND_VOLUME:
+        SetSoundVolume(audio->sound, command.value);
+        break;
+    case AUDIO_QUIT:
+        return false;
+    }
+    return true;
+}
+
+static void *audio_main(void *arg) {
+    AudioThread *audio = (AudioThread *)arg;
+    struct timespec interval = {0, AUDIO_UPDATE_INTERVAL_MS * 1000000L};
+    for (;;) {
+        AudioCommand command;
+        while (take_command(audio, &command)) {
+            if (!run_command(audio, command)) {
+                StopMusicStream(audio->music);
+                StopSound(audio->sound);
+                return NULL;
+            }
+        }
+
+        PROFILE_BEGIN(ZONE_AUDIO);
+        if (audio->music_playing && audio->music.stream.buffer != NULL) {
+            UpdateMusicStream(audio->music);
+        }
+        if (audio->sound_looping && audio->sound.stream.buffer != NULL && !IsSoundPlaying(audio->sound)) {
+            PlaySound(audio->sound);
+        }
+        PROFILE_END(ZONE_AUDIO);
+
+        nanosleep(&interval, NULL);
+    }
+}
+
+// Hand music and sound to a new audio thread. From here on only the audio
+// thread touches them, until audio_stop() returns.
+bool audio_start(AudioThread *audio, Music music, Sound sound) {
+    memset(audio, 0, sizeof(*audio));
+    audio->music = music;
+    audio->sound = sound;
+    audio->running = pthread_create(&audio->thread, NULL, audio_main, audio) == 0;
+    return audio->running;
+}
+
+// Queue a command for the audio thread. Main thread only. Returns false if
+// the queue is full or the thread is not running.
+bool audio_post(AudioThread *audio, AudioCommandType type, float value) {
+    if (!audio->running) {
+        return false;
+    }
+    uint32_t head = audio->head;
+    if (head - __atomic_load_n(&audio->tail, __ATOMIC_ACQUIRE) == AUDIO_QUEUE_SIZE) {
+        return false;
+    }
+    audio->queue[head & (AUDIO_QUEUE_SIZE - 1)] = (AudioCommand){type, value};
+    __atomic_store_n(&audio->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Stop playback and wait for the audio thread to exit
+void audio_stop(AudioThread *audio) {
+    if (!audio->running) {
+        return;
+    }
+    // A full queue drains within one update interval
+    while (!audio_post(audio, AUDIO_QUIT, 0)) {
+        struct timespec wait = {0, AUDIO_UPDATE_INTERVAL_MS * 1000000L};
+        nanosleep(&wait, NULL);
+    }
+    pthread_join(audio->thread, NULL);
+    audio->running = false;
+}
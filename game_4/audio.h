@@ -0,0 +1,53 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+// Audio thread. It owns the music stream and the decoded clips once started
+// and keeps the stream's buffers topped up every few milliseconds, so music
+// keeps playing through long frames. The main thread only posts commands
+// through a lock-free single-producer, single-consumer queue.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <raylib.h>
+
+#define AUDIO_QUEUE_SIZE 64          // Commands in flight, a power of two
+#define AUDIO_UPDATE_INTERVAL_MS 5   // How often the stream is refilled
+#define AUDIO_STREAM_BUFFER_FRAMES 8192 // Per stream buffer, about 185 ms decoded ahead at 44.1 kHz
+
+typedef enum {
+    AUDIO_PLAY_MUSIC,
+    AUDIO_STOP_MUSIC,
+    AUDIO_MUSIC_VOLUME,
+    AUDIO_PLAY_SOUND, // value != 0 loops the clip
+    AUDIO_STOP_SOUND,
+    AUDIO_SOUND_VOLUME,
+    AUDIO_QUIT,
+} AudioCommandType;
+
+typedef struct {
+    AudioCommandType type;
+    float value;
+} AudioCommand;
+
+typedef struct {
+    Music music;
+    Sound sound;
+
+    AudioCommand queue[AUDIO_QUEUE_SIZE];
+    uint32_t head; // Next slot the main thread writes
+    uint32_t tail; // Next slot the audio thread reads
+
+    pthread_t thread;
+    bool running;
+
+    // Audio thread only
+    bool music_playing;
+    bool sound_looping;
+} AudioThread;
+
+bool audio_start(AudioThread *audio, Music music, Sound sound);
+bool audio_post(AudioThread *audio, AudioCommandType type, float value);
+void audio_stop(AudioThread *audio);
+
+#endif
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "autoplay.h"
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Input for one tick of an action; a jump is pressed on the segment's first tick only
+static InputFrame action_input(AutoplayAction action, int segment_tick) {
+    bool jump = action == ACTION_JUMP || action == ACTION_JUMP_LEFT || action == ACTION_JUMP_RIGHT;
+    InputFrame input = {
+        .left = action == ACTION_LEFT || action == ACTION_JUMP_LEFT,
+        .right = action == ACTION_RIGHT || action == ACTION_JUMP_RIGHT,
+        .down = action == ACTION_CROUCH,
+        .jump = jump && segment_tick == 0,
+    };
+    return input;
+}
+
+// Play a plan out from the root snapshot. Ticks survived count most, and
+// among plans that survive equally long the one with fewest actions wins.
+static int evaluate(AutoPlayer *bot, const unsigned char *plan) {
+    double start = now_ns();
+    game_restore(&bot->scratch, &bot->root);
+    bot->stats.restore_ns += now_ns() - start;
+    bot->stats.restores++;
+
+    GameState *state = &bot->scratch;
+    int survived = 0;
+    int actions = 0;
+    for (int segment = 0; segment < AUTOPLAY_PLAN_SEGMENTS && !state->game_over; segment++) {
+        actions += plan[segment] != ACTION_IDLE;
+        for (int t = 0; t < AUTOPLAY_SEGMENT_TICKS && !state->game_over; t++) {
+            game_step(state, action_input(plan[segment], t), bot->dt);
+            survived++;
+        }
+    }
+    bot->stats.lookahead_ticks += survived;
+    return survived * AUTOPLAY_PLAN_SEGMENTS - actions;
+}
+
+static void random_plan(AutoPlayer *bot, unsigned char *plan) {
+    for (int segment = 0; segment < AUTOPLAY_PLAN_SEGMENTS; segment++) {
+        // Actions come in runs so a candidate can walk or duck for a while
+        bool repeat = segment > 0 && rng_range(&bot->rng, 2) == 0;
+        plan[segment] = repeat ? plan[segment - 1] : rng_range(&bot->rng, ACTION_COUNT);
+    }
+}
+
+// Search from the live state and keep the best plan found
+static void decide(AutoPlayer *bot, const GameState *state) {
+    double start = now_ns();
+    game_snapshot(state, &bot->root);
+    bot->stats.snapshot_ns += now_ns() - start;
+    bot->stats.snapshots++;
+
+    // The previous best, one segment on, is the first candidate
+    memmove(bot->plan, bot->plan + 1, AUTOPLAY_PLAN_SEGMENTS - 1);
+    bot->plan[AUTOPLAY_PLAN_SEGMENTS - 1] = ACTION_IDLE;
+    int best_value = evaluate(bot, bot->plan);
+
+    unsigned char candidate[AUTOPLAY_PLAN_SEGMENTS];
+    for (int c = 1; c < AUTOPLAY_CANDIDATES; c++) {
+        if (c == 1) {
+            memset(candidate, ACTION_IDLE, sizeof(candidate));
+        } else if (c < AUTOPLAY_CANDIDATES / 2) {
+            // Mutations of the best plan so far
+            memcpy(candidate, bot->plan, sizeof(candidate));
+            int changes = 1 + rng_range(&bot->rng, 3);
+            for (int i = 0; i < changes; i++) {
+                candidate[rng_range(&bot->rng, AUTOPLAY_PLAN_SEGMENTS)] = rng_range(&bot->rng, ACTION_COUNT);
+            }
+        } else {
+            random_plan(bot, candidate);
+        }
+
+        int value = evaluate(bot, candidate);
+        if (value > best_value) {
+            best_value = value;
+            memcpy(bot->plan, candidate, sizeof(candidate));
+        }
+    }
+
+    bot->stats.decisions++;
+    bot->stats.search_ns += now_ns() - start;
+}
+
+// dt is the tick length the game is stepped with. The bot draws from its
+// own stream of seed, so its choices never touch the game's RNG streams.
+void autoplay_init(AutoPlayer *bot, uint64_t seed, float dt) {
+    memset(bot, 0, sizeof(*bot));
+    rng_seed(&bot->rng, seed, RNG_STREAM_COUNT);
+    bot->dt = dt;
+    bot->segment_tick = AUTOPLAY_SEGMENT_TICKS;
+}
+
+// Input for the next tick of state, replanning at segment boundaries
+InputFrame autoplay_input(AutoPlayer *bot, const GameState *state) {
+    if (bot->segment_tick == AUTOPLAY_SEGMENT_TICKS) {
+        decide(bot, state);
+        bot->segment_tick = 0;
+    }
+    return action_input(bot->plan[0], bot->segment_tick++);
+}
+
+void autoplay_report(const AutoPlayer *bot) {
+    const AutoplayStats *stats = &bot->stats;
+    long decisions = stats->decisions > 0 ? stats->decisions : 1;
+    printf("autoplay:       %ld decisions, %ld lookahead ticks (%.0f per decision), %.1f us per decision\n",
+           stats->decisions, stats->lookahead_ticks, (double)stats->lookahead_ticks / decisions,
+           stats->search_ns / decisions / 1000.0);
+    printf("snapshot:       %zu bytes, %ld taken, %.0f ns each\n", sizeof(GameSnapshot), stats->snapshots,
+           stats->snapshots > 0 ? stats->snapshot_ns / stats->snapshots : 0.0);
+    printf("restore:        %ld, %.0f ns each\n", stats->restores,
+           stats->restores > 0 ? stats->restore_ns / stats->restores : 0.0);
+}
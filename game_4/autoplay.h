@@ -0,0 +1,55 @@
+#ifndef AUTOPLAY_H
+#define AUTOPLAY_H
+
+// Autoplay bot. A plan is a row of actions, each held for one segment of
+// ticks. At every segment boundary the bot snapshots the game, replays a
+// few candidate plans from the snapshot (the previous best shifted by one
+// segment, mutations of it and random ones) and keeps the plan that
+// survives longest. The simulation is deterministic, so the first segment
+// then plays out exactly as it did in the search.
+
+#include <stdint.h>
+
+#include "sim.h"
+
+#define AUTOPLAY_SEGMENT_TICKS 15 // Ticks each action is held, also the replanning interval
+#define AUTOPLAY_PLAN_SEGMENTS 16 // 240 ticks, 4 s ahead at 60 Hz
+#define AUTOPLAY_CANDIDATES 24    // Plans simulated per decision
+
+typedef enum {
+    ACTION_IDLE,
+    ACTION_LEFT,
+    ACTION_RIGHT,
+    ACTION_JUMP,
+    ACTION_JUMP_LEFT,
+    ACTION_JUMP_RIGHT,
+    ACTION_CROUCH,
+    ACTION_COUNT,
+} AutoplayAction;
+
+typedef struct {
+    long decisions;
+    long lookahead_ticks; // Ticks simulated while searching
+    long snapshots;
+    long restores;
+    double snapshot_ns; // Total time in game_snapshot()
+    double restore_ns;  // Total time in game_restore()
+    double search_ns;   // Total time per decision, snapshots and restores included
+} AutoplayStats;
+
+typedef struct {
+    Rng rng;
+    float dt;
+    unsigned char plan[AUTOPLAY_PLAN_SEGMENTS]; // AutoplayAction; plan[0] is playing
+    int segment_tick; // Ticks of plan[0] already played, AUTOPLAY_SEGMENT_TICKS when a decision is due
+    AutoplayStats stats;
+
+    GameSnapshot root; // The live game at the last decision
+    GameState scratch; // Where candidate plans are played out
+} AutoPlayer;
+
+void autoplay_init(AutoPlayer *bot, uint64_t seed, float dt);
+InputFrame autoplay_input(AutoPlayer *bot, const GameState *state);
+void autoplay_report(const AutoPlayer *bot);
+
+#endif
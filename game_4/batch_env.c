@@ -0,0 +1,137 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch_env.h"
+#include "mem.h"
+
+// Seed of an instance's nth game: distinct per instance and per game
+static uint64_t instance_seed(const BatchEnv *batch, int instance, uint32_t episode) {
+    return batch->seed + (uint64_t)instance * 0x9E3779B97F4A7C15ULL + episode;
+}
+
+static void observe(const BatchEnv *batch, int instance) {
+    const GameState *state = &batch->instances[instance];
+    const Character *character = &state->character;
+    float *out = &batch->observations[(size_t)instance * BATCH_OBSERVATION_SIZE];
+    float width = batch->width;
+    float height = batch->height;
+
+    out[0] = character->y / height;
+    out[1] = character->velocity / height;
+    out[2] = (character->x + state->camera_x) / width;
+    out[3] = character->crouching;
+    out[4] = character->jumping;
+
+    // Nearest projectiles not yet past the character, by distance ahead
+    int nearest[BATCH_NEAREST_PROJECTILES];
+    float nearest_dx[BATCH_NEAREST_PROJECTILES];
+    int found = 0;
+    const ProjectilePool *pool = &state->projectiles;
+    for (int i = 0; i < pool->high_water; i++) {
+        if (pool->hazard[i] == PROJECTILE_NONE || pool->x[i] + pool->w[i] < character->x) {
+            continue;
+        }
+        float dx = pool->x[i] - character->x;
+        int slot = found < BATCH_NEAREST_PROJECTILES ? found++ : BATCH_NEAREST_PROJECTILES;
+        while (slot > 0 && nearest_dx[slot - 1] > dx) {
+            if (slot < BATCH_NEAREST_PROJECTILES) {
+                nearest[slot] = nearest[slot - 1];
+                nearest_dx[slot] = nearest_dx[slot - 1];
+            }
+            slot--;
+        }
+        if (slot < BATCH_NEAREST_PROJECTILES) {
+            nearest[slot] = i;
+            nearest_dx[slot] = dx;
+        }
+    }
+
+    float *projectiles = out + 5;
+    for (int k = 0; k < BATCH_NEAREST_PROJECTILES; k++) {
+        if (k < found) {
+            int i = nearest[k];
+            projectiles[3 * k] = nearest_dx[k] / width;
+            projectiles[3 * k + 1] = (pool->y[i] - character->y) / height;
+            projectiles[3 * k + 2] = 1 + pool->hazard[i];
+        } else {
+            projectiles[3 * k] = projectiles[3 * k + 1] = projectiles[3 * k + 2] = 0;
+        }
+    }
+}
+
+static void reset_instance(BatchEnv *batch, int instance) {
+    game_init(&batch->instances[instance], batch->width, batch->height,
+              instance_seed(batch, instance, batch->episodes[instance]));
+}
+
+// Reward: +1 for each point scored this tick, -1 when the game ends
+static void step_range(void *context, int begin, int end) {
+    BatchEnv *batch = (BatchEnv *)context;
+    for (int i = begin; i < end; i++) {
+        GameState *state = &batch->instances[i];
+        int score = state->score;
+        game_step(state, batch->actions[i], batch->dt);
+
+        batch->rewards[i] = state->score - score - (state->game_over ? 1.0f : 0.0f);
+        batch->dones[i] = state->game_over;
+        if (state->game_over) {
+            batch->episodes[i]++;
+            reset_instance(batch, i);
+        }
+        observe(batch, i);
+    }
+}
+
+// False if the arrays cannot be allocated; batch is left empty then
+bool batch_init(BatchEnv *batch, int count, uint64_t seed, JobPool *jobs) {
+    memset(batch, 0, sizeof(*batch));
+    batch->count = count;
+    batch->width = 800 * scale_factor;
+    batch->height = 600 * scale_factor;
+    batch->dt = 1.0f / SIM_TICK_RATE;
+    batch->seed = seed;
+    batch->jobs = jobs;
+
+    batch->instances = (GameState *)mem_alloc(MEM_BATCH, (size_t)count * sizeof(GameState));
+    batch->observations = (float *)mem_alloc(MEM_BATCH, (size_t)count * BATCH_OBSERVATION_SIZE * sizeof(float));
+    batch->rewards = (float *)mem_alloc(MEM_BATCH, (size_t)count * sizeof(float));
+    batch->dones = (unsigned char *)mem_alloc(MEM_BATCH, (size_t)count);
+    batch->episodes = (uint32_t *)mem_calloc(MEM_BATCH, (size_t)count, sizeof(uint32_t));
+    if (batch->instances == NULL || batch->observations == NULL || batch->rewards == NULL || batch->dones == NULL ||
+        batch->episodes == NULL) {
+        batch_free(batch);
+        return false;
+    }
+    batch_reset(batch);
+    return true;
+}
+
+// Start a fresh game in every instance
+void batch_reset(BatchEnv *batch) {
+    for (int i = 0; i < batch->count; i++) {
+        reset_instance(batch, i);
+        observe(batch, i);
+        batch->rewards[i] = 0;
+        batch->dones[i] = 0;
+    }
+}
+
+// Advance every instance one tick with actions[i], in parallel if there is a pool
+void batch_step(BatchEnv *batch, const InputFrame *actions) {
+    batch->actions = actions;
+    if (batch->jobs != NULL) {
+        jobs_parallel_for(batch->jobs, batch->count, BATCH_GRAIN, step_range, batch);
+    } else {
+        step_range(batch, 0, batch->count);
+    }
+    batch->actions = NULL;
+}
+
+void batch_free(BatchEnv *batch) {
+    mem_free(batch->instances);
+    mem_free(batch->observations);
+    mem_free(batch->rewards);
+    mem_free(batch->dones);
+    mem_free(batch->episodes);
+    memset(batch, 0, sizeof(*batch));
+}
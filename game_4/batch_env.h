@@ -0,0 +1,47 @@
+#ifndef BATCH_ENV_H
+#define BATCH_ENV_H
+
+// Many independent games stepped in lockstep, for bots and tuning runs.
+// The GameStates sit back to back in one arena allocated up front, and
+// every step writes observations, rewards and done flags into flat arrays,
+// so stepping allocates nothing. Steps run on a JobPool, or on the calling
+// thread alone if it is NULL.
+//
+// An instance whose game ends is reset with its next seed inside the same
+// step: that step reports done = 1 and the reward of the final tick, and
+// its observation is already the first one of the new game.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sim.h"
+#include "jobs.h"
+
+#define BATCH_NEAREST_PROJECTILES 4
+// Character: y, velocity, x on screen, crouching, jumping; then for each of
+// the nearest projectiles ahead: dx, dy, 1 + hazard type (0 for none)
+#define BATCH_OBSERVATION_SIZE (5 + 3 * BATCH_NEAREST_PROJECTILES)
+#define BATCH_GRAIN 8 // Instances per scheduled range
+
+typedef struct {
+    int count;
+    int width;
+    int height;
+    float dt;
+    uint64_t seed;
+    JobPool *jobs; // NULL steps serially
+
+    GameState *instances;    // count states, one arena
+    float *observations;     // count * BATCH_OBSERVATION_SIZE
+    float *rewards;          // count
+    unsigned char *dones;    // count
+    uint32_t *episodes;      // count, games finished per instance
+    const InputFrame *actions; // Set for the duration of batch_step()
+} BatchEnv;
+
+bool batch_init(BatchEnv *batch, int count, uint64_t seed, JobPool *jobs);
+void batch_reset(BatchEnv *batch);
+void batch_step(BatchEnv *batch, const InputFrame *actions);
+void batch_free(BatchEnv *batch);
+
+#endif
@@ -0,0 +1,285 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <float.h>
+#include <math.h>
+
+#include "collision.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define COLLISION_X86 1
+#include <immintrin.h>
+#endif
+
+typedef int (*FirstHitFn)(const ProjectilePool *pool, SimRect box, int start, int end);
+
+// Overlap test with the same strict comparisons as check_collision_rects,
+// over slots [start, end)
+static int first_hit_scalar(const ProjectilePool *pool, SimRect box, int start, int end) {
+    float x0 = box.x, x1 = box.x + box.width;
+    float y0 = box.y, y1 = box.y + box.height;
+    for (int i = start; i < end; i++) {
+        if (x0 < pool->hit_x1[i] && x1 > pool->hit_x0[i] && y0 < pool->hit_y1[i] && y1 > pool->hit_y0[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef COLLISION_X86
+__attribute__((target("sse2")))
+static int first_hit_sse2(const ProjectilePool *pool, SimRect box, int start, int end) {
+    __m128 x0 = _mm_set1_ps(box.x), x1 = _mm_set1_ps(box.x + box.width);
+    __m128 y0 = _mm_set1_ps(box.y), y1 = _mm_set1_ps(box.y + box.height);
+    int i = start;
+    for (; i + 4 <= end; i += 4) {
+        __m128 overlap_x = _mm_and_ps(_mm_cmplt_ps(x0, _mm_loadu_ps(&pool->hit_x1[i])),
+                                      _mm_cmpgt_ps(x1, _mm_loadu_ps(&pool->hit_x0[i])));
+        __m128 overlap_y = _mm_and_ps(_mm_cmplt_ps(y0, _mm_loadu_ps(&pool->hit_y1[i])),
+                                      _mm_cmpgt_ps(y1, _mm_loadu_ps(&pool->hit_y0[i])));
+        int mask = _mm_movemask_ps(_mm_and_ps(overlap_x, overlap_y));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return first_hit_scalar(pool, box, i, end);
+}
+
+__attribute__((target("avx2")))
+static int first_hit_avx2(const ProjectilePool *pool, SimRect box, int start, int end) {
+    __m256 x0 = _mm256_set1_ps(box.x), x1 = _mm256_set1_ps(box.x + box.width);
+    __m256 y0 = _mm256_set1_ps(box.y), y1 = _mm256_set1_ps(box.y + box.height);
+    int i = start;
+    for (; i + 8 <= end; i += 8) {
+        __m256 overlap_x = _mm256_and_ps(_mm256_cmp_ps(x0, _mm256_loadu_ps(&pool->hit_x1[i]), _CMP_LT_OQ),
+                                         _mm256_cmp_ps(x1, _mm256_loadu_ps(&pool->hit_x0[i]), _CMP_GT_OQ));
+        __m256 overlap_y = _mm256_and_ps(_mm256_cmp_ps(y0, _mm256_loadu_ps(&pool->hit_y1[i]), _CMP_LT_OQ),
+                                         _mm256_cmp_ps(y1, _mm256_loadu_ps(&pool->hit_y0[i]), _CMP_GT_OQ));
+        int mask = _mm256_movemask_ps(_mm256_and_ps(overlap_x, overlap_y));
+        if (mask != 0) {
+            _mm256_zeroupper();
+            return i + __builtin_ctz(mask);
+        }
+    }
+    // Clear the upper halves explicitly: at -O1 the compiler does not, and
+    // every SSE instruction after this call would pay for the dirty state
+    _mm256_zeroupper();
+    for (; i < end; i++) {
+        if (box.x < pool->hit_x1[i] && box.x + box.width > pool->hit_x0[i] &&
+            box.y < pool->hit_y1[i] && box.y + box.height > pool->hit_y0[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+#endif
+
+static FirstHitFn first_hit = first_hit_scalar;
+static const char *kernel_name = "scalar";
+static bool kernel_chosen = false;
+static bool pixel_hitboxes = true;
+
+// Pick a kernel by name. Returns false if the name is unknown or the CPU lacks it.
+bool collision_select_kernel(const char *name) {
+    if (strcmp(name, "scalar") == 0) {
+        first_hit = first_hit_scalar;
+        kernel_name = "scalar";
+        return true;
+    }
+#ifdef COLLISION_X86
+    __builtin_cpu_init();
+    if (strcmp(name, "sse2") == 0 && __builtin_cpu_supports("sse2")) {
+        first_hit = first_hit_sse2;
+        kernel_name = "sse2";
+        return true;
+    }
+    if (strcmp(name, "avx2") == 0 && __builtin_cpu_supports("avx2")) {
+        first_hit = first_hit_avx2;
+        kernel_name = "avx2";
+        return true;
+    }
+#endif
+    return false;
+}
+
+// "mask" (the default) tests solid pixels, "rect" only their bounding boxes.
+// Returns false if the name is unknown.
+bool collision_select_hitboxes(const char *name) {
+    if (strcmp(name, "mask") != 0 && strcmp(name, "rect") != 0) {
+        return false;
+    }
+    pixel_hitboxes = strcmp(name, "mask") == 0;
+    return true;
+}
+
+const char *collision_hitboxes_name(void) {
+    return pixel_hitboxes ? "mask" : "rect";
+}
+
+// Choose the widest kernel the CPU supports. Called by game_init(); call it
+// before starting threads that step games.
+void collision_init(void) {
+    if (kernel_chosen) {
+        return;
+    }
+    kernel_chosen = true;
+    const char *hitboxes = getenv("GAME_HITBOXES");
+    if (hitboxes != NULL) {
+        collision_select_hitboxes(hitboxes);
+    }
+    const char *forced = getenv("GAME_COLLISION_KERNEL");
+    if (forced != NULL && collision_select_kernel(forced)) {
+        return;
+    }
+    if (!collision_select_kernel("avx2") && !collision_select_kernel("sse2")) {
+        collision_select_kernel("scalar");
+    }
+}
+
+const char *collision_kernel_name(void) {
+    return kernel_name;
+}
+
+// Times during a move of v at which [a0, a1] + v * t overlaps [b0, b1]: the
+// open interval (*enter, *exit). Returns false if they never overlap.
+static bool axis_overlap_times(float a0, float a1, float b0, float b1, float v, float *enter, float *exit) {
+    if (v == 0) {
+        *enter = -FLT_MAX;
+        *exit = FLT_MAX;
+        return a0 < b1 && a1 > b0;
+    }
+    float t0 = (b0 - a1) / v;
+    float t1 = (b1 - a0) / v;
+    *enter = t0 < t1 ? t0 : t1;
+    *exit = t0 < t1 ? t1 : t0;
+    return true;
+}
+
+static int round_to_pixel(float x) {
+    return (int)floorf(x + 0.5f);
+}
+
+// Test mask at (x, y) moving by (dx, dy) over the tick against other at
+// (other_x, other_y) moving by (-other_dx, 0), both given at the end of the
+// tick, at points of [enter, exit] at most HITMASK_SWEEP_STEP pixels of
+// relative motion apart. Returns the first time they share a pixel, or -1.
+static float masks_meet(const HitMask *mask, float x, float y, float dx, float dy, const HitMask *other,
+                        float other_x, float other_y, float other_dx, float enter, float exit) {
+    float speed_x = fabsf(dx + other_dx);
+    float speed_y = fabsf(dy);
+    int steps = (int)((speed_x > speed_y ? speed_x : speed_y) * (exit - enter) / HITMASK_SWEEP_STEP) + 1;
+    for (int s = 0; s <= steps; s++) {
+        float time = enter + (exit - enter) * s / steps;
+        float rest = 1 - time; // Of the tick, still to move
+        if (hitmask_overlap(mask, round_to_pixel(x - dx * rest), round_to_pixel(y - dy * rest), other,
+                            round_to_pixel(other_x + other_dx * rest), round_to_pixel(other_y))) {
+            return time;
+        }
+    }
+    return -1;
+}
+
+// The character's move over a tick, and results per chunk of the pool
+typedef struct {
+    const ProjectilePool *pool;
+    const HitMask *mask;
+    float x, y, dx, dy;
+    SimRect start; // Character's hitbox at the start of the tick
+    SimRect broad; // Every box its path covers, widened by the furthest a projectile moved
+    int found;     // Lowest chunk with a hit so far, atomic
+    int hit[PROJECTILE_MAX_CHUNKS];
+    float time[PROJECTILE_MAX_CHUNKS];
+} Sweep;
+
+// First projectile in slots [begin, end) whose path met the character's
+static int sweep_range(const Sweep *sweep, int begin, int end, float *time) {
+    const ProjectilePool *pool = sweep->pool;
+    SimRect start = sweep->start;
+    float x = sweep->x, y = sweep->y, dx = sweep->dx, dy = sweep->dy;
+    for (int i = first_hit(pool, sweep->broad, begin, end); i != -1; i = first_hit(pool, sweep->broad, i + 1, end)) {
+        // Move the character relative to the projectile's start position
+        float projectile_dx = pool->prev_x[i] - pool->x[i];
+        float enter_x, exit_x, enter_y, exit_y;
+        if (!axis_overlap_times(start.x, start.x + start.width, pool->hit_x0[i] + projectile_dx,
+                                pool->hit_x1[i] + projectile_dx, dx + projectile_dx, &enter_x, &exit_x) ||
+            !axis_overlap_times(start.y, start.y + start.height, pool->hit_y0[i], pool->hit_y1[i], dy, &enter_y,
+                                &exit_y)) {
+            continue;
+        }
+        float enter = enter_x > enter_y ? enter_x : enter_y;
+        float exit = exit_x < exit_y ? exit_x : exit_y;
+        enter = enter > 0 ? enter : 0;
+        exit = exit < 1 ? exit : 1;
+        if (enter >= exit) {
+            continue;
+        }
+        const HazardType *type = &hazards.types[pool->hazard[i]];
+        if (pixel_hitboxes && type->pixel_hits) {
+            const HitMask *other = &hitmasks[projectile_types[type->sprite].mask];
+            enter = masks_meet(sweep->mask, x, y, dx, dy, other, pool->x[i], pool->y[i], projectile_dx, enter, exit);
+            if (enter < 0) {
+                continue;
+            }
+        }
+        *time = enter;
+        return i;
+    }
+    return -1;
+}
+
+// Chunks past one that already has a hit cannot hold the first one: skip them
+static void sweep_chunks(void *context, int first, int last) {
+    Sweep *sweep = (Sweep *)context;
+    int high_water = sweep->pool->high_water;
+    for (int chunk = first; chunk < last; chunk++) {
+        sweep->hit[chunk] = -1;
+        if (chunk > __atomic_load_n(&sweep->found, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        int begin = chunk * PROJECTILE_CHUNK;
+        int end = begin + PROJECTILE_CHUNK < high_water ? begin + PROJECTILE_CHUNK : high_water;
+        sweep->hit[chunk] = sweep_range(sweep, begin, end, &sweep->time[chunk]);
+        if (sweep->hit[chunk] == -1) {
+            continue;
+        }
+        int found = __atomic_load_n(&sweep->found, __ATOMIC_RELAXED);
+        while (chunk < found &&
+               !__atomic_compare_exchange_n(&sweep->found, &found, chunk, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        }
+    }
+}
+
+// Swept test. mask is the character's, drawn at (x, y) at the end of the
+// tick after moving by (dx, dy) during it; each projectile moved left by
+// prev_x - x over the same tick. Returns the first projectile whose path
+// met the character's, with the fraction of the tick at which they first
+// touched in *time, or -1. "First" is by slot, with or without jobs.
+int projectile_first_swept_hit(const ProjectilePool *pool, const HitMask *mask, float x, float y, float dx, float dy,
+                               float *time) {
+    Sweep sweep = {.pool = pool, .mask = mask, .x = x, .y = y, .dx = dx, .dy = dy};
+    SimRect box = {x + mask->x0, y + mask->y0, mask->x1 - mask->x0, mask->y1 - mask->y0};
+    sweep.start = (SimRect){box.x - dx, box.y - dy, box.width, box.height};
+
+    // Projectiles outside the broad box (plus rounding slack) cannot have met the character
+    SimRect start = sweep.start;
+    float step = pool->max_step + 1;
+    float x0 = (start.x < box.x ? start.x : box.x) - step;
+    float x1 = (start.x > box.x ? start.x : box.x) + box.width;
+    float y0 = start.y < box.y ? start.y : box.y;
+    float y1 = (start.y > box.y ? start.y : box.y) + box.height;
+    sweep.broad = (SimRect){x0, y0, x1 - x0, y1 - y0};
+
+    int chunks = projectile_chunk_count(pool);
+    if (chunks == 0) {
+        return sweep_range(&sweep, 0, pool->high_water, time);
+    }
+    sweep.found = chunks;
+    jobs_parallel_for(projectile_jobs, chunks, 1, sweep_chunks, &sweep);
+    for (int chunk = 0; chunk < chunks; chunk++) {
+        if (sweep.hit[chunk] != -1) {
+            *time = sweep.time[chunk];
+            return sweep.hit[chunk];
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,31 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+// Batched overlap test of one box against every projectile hitbox.
+// The kernel is picked at startup: AVX2 (8 boxes per step) when the CPU has
+// it, SSE2 (4 per step) on other x86-64 machines, scalar elsewhere. The
+// GAME_COLLISION_KERNEL environment variable (scalar, sse2, avx2) overrides it.
+//
+// projectile_first_swept_hit() tests the paths boxes took over a tick rather
+// than where they ended, so nothing fast steps over the character between
+// ticks. The kernel above prunes projectiles whose paths cannot meet first;
+// the rest are swept as bounding boxes of their solid pixels, and where
+// those meet, the pixel masks (hitmask.h) are tested along the stretch of
+// the tick in which they do. GAME_HITBOXES=rect skips the mask test.
+
+#include <stdbool.h>
+
+#include "sim.h"
+#include "hitmask.h"
+
+#define HITMASK_SWEEP_STEP 2.0f // Pixels of relative motion between mask tests within a tick
+
+void collision_init(void);
+bool collision_select_kernel(const char *name);
+const char *collision_kernel_name(void);
+bool collision_select_hitboxes(const char *name);
+const char *collision_hitboxes_name(void);
+int projectile_first_swept_hit(const ProjectilePool *pool, const HitMask *mask, float x, float y, float dx, float dy,
+                               float *time);
+
+#endif
@@ -1,630 +1,393 @@
-#include <stdio.h>
-#include <raylib.h>
-#include <math.h> // Include math.h for fabs()
-#include <time.h> // Include time.h for time()
-#include <stdlib.h> // Include stdlib.h for rand() and srand()
-#include <stdbool.h>
-#include <string.h>
-
-#define scale_factor 1.5
-#define BRIGHT_RED (Color){ 255, 0, 0, 255 }
-
-// Arrow Parameters
-typedef struct {
-    int x;
-    int y;
-    int width;
-    int height;
-    int speed;
-    Texture2D texture;
-} Arrow;
-
-// Sword Parameters
-typedef struct {
-    int x;
-    int y;
-    int width;
-    int height;
-    int speed;
-    Texture2D texture;
-} Sword;
-
-// Character Parameters
-typedef struct {
-    int x;
-    int y;
-    int width;
-    int height_stand;
-    int height_crouch;
-    int velocity;
-    int direction;
-    int speed;
-    bool jumping;
-    bool walking;
-    bool crouching; // Add crouching state
-} Character;
-
-// Platforms Differ
-typedef enum {
-    PLATFORM,
-    FLOOR,
-} PlatformType;
-
-// Platform Parameters
-typedef struct {
-    int x;
-    int y;
-    int width;
-    int height;
-    PlatformType type;
-} Platform;
-
-typedef struct {
-    Arrow *arrows;
-    int count;
-    int capacity;
-} ArrowList;
-
-typedef struct {
-    Sword *swords;
-    int count;
-    int capacity;
-} SwordList;
-
-float rand_float() {
-    return (float)((float)rand() / RAND_MAX);
-}
-
-// Arrow Creation Function
-Arrow create_arrow(Texture2D arrow_texture, int x, int floor_y) {
-    Arrow arrow;
-    arrow.width = arrow_texture.width;
-    arrow.height = arrow_texture.height;
-    arrow.x = x; // Set the x position
-    arrow.y = rand() % (floor_y - arrow.height); // Random y position above the floor
-    arrow.speed = 5; // Speed of the arrow
-    arrow.texture = arrow_texture;
-    return arrow;
-}
-
-// Sword Creation Function
-Sword create_sword(Texture2D sword_texture, int x, int floor_y) {
-    Sword sword;
-    sword.width = sword_texture.width;
-    sword.height = sword_texture.height;
-    sword.x = x; // Set the x position
-    sword.y = rand() % (floor_y - sword.height); // Random y position above the floor
-    sword.speed = 7; // Higher speed than the arrow
-    sword.texture = sword_texture;
-    return sword;
-}
-
-// Moving Arrow
-void update_arrow(Arrow *arrow, int width, int camera_offset_x, int score) {
-    arrow->x -= arrow->speed + score / 10; // Increase speed based on score
-    if (arrow->x < camera_offset_x) {
-        arrow->x = width + camera_offset_x; // Reset to the right edge if it goes off-screen
-        arrow->y = rand() % (width - arrow->height); // Random y position
-    }
-}
-
-// Moving Sword
-void update_sword(Sword *sword, int width, int camera_offset_x, int score) {
-    sword->x -= sword->speed + score / 10; // Increase speed based on score
-    if (sword->x < camera_offset_x) {
-        sword->x = width + camera_offset_x; // Reset to the right edge if it goes off-screen
-        sword->y = rand() % (width - sword->height); // Random y position
-    }
-}
-
-void init_arrow_list(ArrowList *arrow_list, int initial_capacity) {
-    arrow_list->arrows = (Arrow *)malloc(initial_capacity * sizeof(Arrow));
-    arrow_list->count = 0;
-    arrow_list->capacity = initial_capacity;
-}
-
-void add_arrow(ArrowList *arrow_list, Arrow arrow) {
-    if (arrow_list->count >= arrow_list->capacity) {
-        arrow_list->capacity *= 2;
-        arrow_list->arrows = (Arrow *)realloc(arrow_list->arrows, arrow_list->capacity * sizeof(Arrow));
-    }
-    arrow_list->arrows[arrow_list->count++] = arrow;
-}
-
-void update_arrows(ArrowList *arrow_list, int width, int camera_offset_x, int score) {
-    for (int i = 0; i < arrow_list->count; i++) {
-        update_arrow(&arrow_list->arrows[i], width, camera_offset_x, score);
-    }
-}
-
-void draw_arrows(ArrowList *arrow_list) {
-    for (int i = 0; i < arrow_list->count; i++) {
-        DrawTexture(arrow_list->arrows[i].texture, arrow_list->arrows[i].x, arrow_list->arrows[i].y, WHITE);
-    }
-}
-
-void init_sword_list(SwordList *sword_list, int initial_capacity) {
-    sword_list->swords = (Sword *)malloc(initial_capacity * sizeof(Sword));
-    sword_list->count = 0;
-    sword_list->capacity = initial_capacity;
-}
-
-void add_sword(SwordList *sword_list, Sword sword) {
-    if (sword_list->count >= sword_list->capacity) {
-        sword_list->capacity *= 2;
-        sword_list->swords = (Sword *)realloc(sword_list->swords, sword_list->capacity * sizeof(Sword));
-    }
-    sword_list->swords[sword_list->count++] = sword;
-}
-
-void update_swords(SwordList *sword_list, int width, int camera_offset_x, int score) {
-    for (int i = 0; i < sword_list->count; i++) {
-        update_sword(&sword_list->swords[i], width, camera_offset_x, score);
-    }
-}
-
-void draw_swords(SwordList *sword_list) {
-    for (int i = 0; i < sword_list->count; i++) {
-        DrawTexture(sword_list->swords[i].texture, sword_list->swords[i].x, sword_list->swords[i].y, WHITE);
-    }
-}
-
-// Function to check if the character is colliding with any platform
-int character_on_platform(Character character, Platform platforms[], int platform_count) {
-    for (int i = 0; i < platform_count; i++) {
-        Platform platform = platforms[i];
-        Rectangle platform_rec = {.x = platform.x, .y = platform.y, .width = platform.width, .height = platform.height};
-        Rectangle character_rec = {.x = character.x + 10, .y = character.y + character.height_stand - character.height_stand * 0.2,
-                                   .width = character.width - 15, .height = character.height_stand* 0.2 + 1};
-
-        // Check if the character is colliding with the platform
-        if (CheckCollisionRecs(character_rec, platform_rec)) {
-            return i;
-        }
-    }
-    return -1;
-}
-
-bool check_character_collision(Character character, ArrowList *arrow_list, SwordList *sword_list, bool crouching) {
-    Rectangle character_rect;
-    if (crouching) {
-        character_rect = (Rectangle){
-            .x = character.x + character.width * 0.2f,
-            .y = character.y + character.height_stand - character.height_crouch + character.height_crouch * 0.1f,
-            .width = character.width * 0.6f,
-            .height = character.height_crouch * 0.8f
-        };
-    } else {
-        character_rect = (Rectangle){
-            .x = character.x + character.width * 0.2f,
-            .y = character.y + character.height_stand * 0.1f,
-            .width = character.width * 0.6f,
-            .height = character.height_stand * 0.8f
-        };
-    }
-
-    // Check collision with arrows
-    for (int i = 0; i < arrow_list->count; i++) {
-        Rectangle arrow_rect = {
-            .x = arrow_list->arrows[i].x + arrow_list->arrows[i].width * 0.2f,
-            .y = arrow_list->arrows[i].y + arrow_list->arrows[i].height * 0.2f,
-            .width = arrow_list->arrows[i].width * 0.6f,
-            .height = arrow_list->arrows[i].height * 0.6f
-        };
-        if (CheckCollisionRecs(character_rect, arrow_rect)) {
-            return true;
-        }
-    }
-
-    // Check collision with swords
-    for (int i = 0; i < sword_list->count; i++) {
-        Rectangle sword_rect = {
-            .x = sword_list->swords[i].x + sword_list->swords[i].width * 0.2f,
-            .y = sword_list->swords[i].y + sword_list->swords[i].height * 0.2f,
-            .width = sword_list->swords[i].width * 0.6f,
-            .height = sword_list->swords[i].height * 0.6f
-        };
-        if (CheckCollisionRecs(character_rect, sword_rect)) {
-            return true;
-        }
-    }
-
-    return false;
-}
-
-int main() {
-    srand(time(NULL));
-    int width = 800 * scale_factor;
-    int height = 600 * scale_factor;
-
-    InitWindow(width, height, "Survive The Jungle");
-    SetTargetFPS(60);
-
-    // Initialize audio device
-    InitAudioDevice();
-
-    // Initialize character properties
-    Character character = {.x = width / 2,
-                           .y = height / 2,
-                           .width = 101,
-                           .height_stand = 260,
-                           .height_crouch = 130,
-                           .velocity = 4 * scale_factor,
-                           .speed = 7,
-                           .jumping = false,
-                           .walking = false,};
-
-    // Initialize gravity
-    float gravity = 2.3 * scale_factor;
-
-    // Initialize camera
-    Vector2 cam_offset = {.x = 0, .y = 0};
-    Vector2 cam_target = {.x = 0, .y = 0};
-
-    Camera2D camera = {
-        .offset = cam_offset,
-        .target = cam_target,
-        .rotation = 0.0,
-        .zoom = 1.0
-    };
-
-    float platform_spacing = 0.01;
-    int platform1_whitespace = 45;
-    int platform2_whitespace = 20;
-
-    int world_width = width * 10;
-    int platform_width = 201;
-    int platform_count = world_width / (platform_width + platform_spacing * width);
-
-    int floor_piece_width = 490;
-    int floor_piece_height = 190;
-    int floor_piece_count = ceil((float)world_width / (float)floor_piece_width);
-    int platform_height = 50;
-
-    int platform_min_y = (int)(height * 0.2);
-    int platform_max_y = (int)(height - floor_piece_height - platform_height - platform_min_y);
-    int floor_spacing = 33;
-
-    // Background Image
-    Texture2D background_texture = LoadTexture("img/background.png");
-    int background_width = 1792;
-    int backgroung_overflow = background_width - width;
-    float background_ratio = 1 / ((float)(world_width - width) / (float)(backgroung_overflow));
-    int background_x = 0;
-
-    platform_count += floor_piece_count;
-
-    // Load the arrow texture
-    Texture2D arrow_texture = LoadTexture("img/arrow4.png");
-
-    // Load the sword texture
-    Texture2D sword_texture = LoadTexture("img/sward.png");
-
-    // Initialize the arrow list
-    ArrowList arrow_list;
-    init_arrow_list(&arrow_list, 10);
-
-    // Initialize the sword list
-    SwordList sword_list;
-    init_sword_list(&sword_list, 10);
-
-    // Initialize platforms
-    Platform platforms[platform_count + 1];
-
-    // Platforms1
-    Image platform1_img = LoadImage("img/platform1.png");
-    Texture2D platform1_texture = LoadTextureFromImage(platform1_img);
-    UnloadImage(platform1_img);
-
-    // Platforms2
-    Image platform2_img = LoadImage("img/platform2.png");
-    Texture2D platform2_texture = LoadTextureFromImage(platform2_img);
-    UnloadImage(platform2_img);
-
-    // Floor (Ground)
-    Image floor_img = LoadImage("img/floor.png");
-    Texture2D floor_piece_texture = LoadTextureFromImage(floor_img);
-    UnloadImage(floor_img);
-
-    int i = 0;
-    int floor_x = 0;
-    for (; i < floor_piece_count; i++) {
-        platforms[i].x = floor_x;
-        platforms[i].y = height - floor_piece_height + floor_spacing;
-        platforms[i].width = floor_piece_width;
-        platforms[i].height = floor_piece_height;
-        platforms[i].type = FLOOR;
-        floor_x += platforms[i].width; // Increment floor_x
-    }
-
-    int platform_x = (int)(width * 0.1);
-
-    for (; i <= platform_count; i++) {
-        int random_number = rand_float() * platform_max_y;
-        platforms[i].x = platform_x;
-        platforms[i].y = rand_float() * platform_max_y + platform_min_y;
-        platforms[i].width = platform_width;
-        platforms[i].height = platform_height;
-        platforms[i].type = PLATFORM;
-        platform_x += platforms[i].width + (int)(platform_width * platform_spacing);
-    }
-
-    // Character standing
-    Image character_standing = LoadImage("img/standing.png");
-    Texture2D character_standing_right = LoadTextureFromImage(character_standing);
-    ImageFlipHorizontal(&character_standing);
-    Texture2D character_standing_left = LoadTextureFromImage(character_standing);
-    UnloadImage(character_standing);
-
-    // Character Jumping
-    Image character_jumping = LoadImage("img/jumping.png");
-    Texture2D character_jumping_right = LoadTextureFromImage(character_jumping);
-    ImageFlipHorizontal(&character_jumping);
-    Texture2D character_jumping_left = LoadTextureFromImage(character_jumping);
-    UnloadImage(character_jumping);
-
-    // Character walking
-    // Walk 1
-    Image character_walk1 = LoadImage("img/walk1.png");
-    Texture2D character_walk1_right = LoadTextureFromImage(character_walk1);
-    ImageFlipHorizontal(&character_walk1);
-    Texture2D character_walk1_left = LoadTextureFromImage(character_walk1);
-    UnloadImage(character_walk1);
-
-    // Walk 2
-    Image character_walk2 = LoadImage("img/walk2.png");
-    Texture2D character_walk2_right = LoadTextureFromImage(character_walk2);
-    ImageFlipHorizontal(&character_walk2);
-    Texture2D character_walk2_left = LoadTextureFromImage(character_walk2);
-    UnloadImage(character_walk2);
-
-    // Character crouching
-    Image character_crouching_left_img = LoadImage("img/crouch1.png");
-    Texture2D character_crouching_left = LoadTextureFromImage(character_crouching_left_img);
-    UnloadImage(character_crouching_left_img);
-
-    Image character_crouching_right_img = LoadImage("img/crouch2.png");
-    Texture2D character_crouching_right = LoadTextureFromImage(character_crouching_right_img);
-    UnloadImage(character_crouching_right_img);
-
-    float arrow_timer = 0.0f;
-    const float arrow_interval = 2.3f; // Interval in seconds
-
-    float sword_timer = 0.0f;
-    const float sword_interval = 10.0f; // Interval in seconds
-
-    const char *game_over_text = "Game Over!";
-
-    // Load the game over texture
-    Texture2D game_over_texture = LoadTexture("img/Game Over.png");
-
-    //New variables for score
-    int score = 0;
-    float score_timer = 0.0f;
-    const float score_interval = 1.3f; // Interval in seconds
-
-    // Load and play background music
-    Music background_music = LoadMusicStream("img/background_music.mp3");
-    Music gameover_music = LoadMusicStream("img/gameover1.mp3");
-    PlayMusicStream(background_music);
-    SetMusicVolume(background_music, 0.5f);  // Set volume to 50%, adjust as needed
-    SetMusicVolume(gameover_music, 0.5f);  // Set volume for game over music
-
-    bool game_over = false;
-    bool gameover_music_started = false;
-
-
-    // Game loop
-    while (!WindowShouldClose()) {
-        //Updating Background Music
-        if (!game_over) {
-            UpdateMusicStream(background_music);
-        } else {
-            if (!gameover_music_started) {
-                StopMusicStream(background_music);
-                PlayMusicStream(gameover_music);
-                gameover_music_started = true;
-            }
-            UpdateMusicStream(gameover_music);
-        }
-
-
-        float delta_time = GetFrameTime(); // Get the time elapsed since the last frame
-        arrow_timer += delta_time; // Update the arrow timer
-        sword_timer += delta_time; // Update the sword timer
-
-        BeginDrawing();
-
-        character.walking = false;
-        character.crouching = false; // Reset crouching state
-
-        if (character.x > width * 0.6) {
-            camera.offset.x = -(character.x - width * 0.6);
-        } else if (character.x < width * 0.4) {
-            camera.offset.x = -(character.x - width * 0.6);
-        }
-
-        if (camera.offset.x > 0) {
-            camera.offset.x = 0;
-        }
-        if (camera.offset.x < -(world_width - width)) {
-            camera.offset.x = -(world_width - width);
-        }
-
-        BeginMode2D(camera);
-
-        background_x = -(camera.offset.x);
-        background_x -= background_x * background_ratio;
-
-        if (!game_over) {
-            // Update character's position and velocity
-            character.y += character.velocity;
-            character.velocity += gravity;
-
-            // Check if character is on any platform
-            int current_platform = character_on_platform(character, platforms, platform_count);
-            if (current_platform != -1) {
-                if (character.velocity > 0) {
-                    character.velocity = 0;
-                    character.y = platforms[current_platform].y - character.height_stand;
-                    character.jumping = false;
-                }
-                // Jump if space is pressed
-                if (IsKeyPressed(KEY_SPACE)) {
-                    character.velocity = -30 * scale_factor; // Negative velocity to make the character jump
-                    character.jumping = true;
-                }
-            }
-
-            // Move the character
-            if (IsKeyDown(KEY_LEFT)) {
-                character.walking = true;
-                character.x -= character.speed * scale_factor;
-                character.direction = -1;
-            }
-
-            if (IsKeyDown(KEY_RIGHT)) {
-                character.walking = true;
-                character.x += character.speed * scale_factor;
-                character.direction = 1;
-            }
-
-            // Crouch the character
-            if (IsKeyDown(KEY_DOWN)) {
-                character.crouching = true; 
-            }
-
-            // Generate new arrow at the rightmost x coordinate of the screen every 2.5 seconds
-            if (arrow_timer >= arrow_interval) {
-                int rightmost_x = width - camera.offset.x;
-                int floor_y = height - floor_piece_height + floor_spacing;
-                Arrow new_arrow = create_arrow(arrow_texture, rightmost_x, floor_y);
-                add_arrow(&arrow_list, new_arrow);
-                arrow_timer = 0.0f; // Reset the timer
-            }
-
-            // Generate new sword at the rightmost x coordinate of the screen every 10 seconds
-            if (sword_timer >= sword_interval) {
-                int rightmost_x = width - camera.offset.x;
-                int floor_y = height - floor_piece_height + floor_spacing;
-                Sword new_sword = create_sword(sword_texture, rightmost_x, floor_y);
-                add_sword(&sword_list, new_sword);
-                sword_timer = 0.0f; // Reset the timer
-            }
-
-            // Update game logic
-            update_arrows(&arrow_list, width, camera.offset.x, score);
-            update_swords(&sword_list, width, camera.offset.x, score);
-
-            // Check for collision
-            game_over = check_character_collision(character, &arrow_list, &sword_list,character.crouching);
-
-            // Update score
-            score_timer += delta_time;
-            if (score_timer >= score_interval) {
-                score++;
-                score_timer = 0.0f; // Reset the timer
-            }
-        }
-
-        // Clear the background
-        ClearBackground(WHITE);
-
-        // Draw background
-        DrawTexture(background_texture, background_x, 0, WHITE);
-
-        // Draw character platforms
-        for (int i = 0; i < platform_count; i++) {
-            if (platforms[i].type == FLOOR) {
-                DrawTexture(floor_piece_texture, platforms[i].x - 20, platforms[i].y - floor_spacing, WHITE);
-            } else {
-                Texture2D platform_texture = platform1_texture;
-                int whitespace = platform1_whitespace;
-                if (i % 2 == 0) {
-                    platform_texture = platform2_texture;
-                    whitespace = platform2_whitespace;
-                }
-                DrawTexture(platform_texture, platforms[i].x, platforms[i].y - whitespace, WHITE);
-            }
-        }
-
-        // Draw the character
-        Texture2D character_texture;
-        if (character.crouching) {
-            character_texture = (character.direction == -1) ? character_crouching_left : character_crouching_right;
-        } else if (character.jumping) {
-            character_texture = (character.direction == -1) ? character_jumping_left : character_jumping_right;
-        } else if (character.walking) {
-            double time = GetTime() * 10 / 2;
-            character_texture = (character.direction == -1) ? ((int)time % 2 == 0 ? character_walk1_left : character_walk2_left) : ((int)time % 2 == 0 ? character_walk1_right : character_walk2_right);
-        } else {
-            character_texture = (character.direction == -1) ? character_standing_left : character_standing_right;
-        }
-
-        if (character.x < 0) {
-            character.x = 0;
-        }
-        if (character.x > world_width - character.width) {
-            character.x = world_width - character.width;
-        }
-
-        if(character.crouching==true){
-            DrawTexture(character_texture, character.x, character.y+135, WHITE);
-        }else{
-            DrawTexture(character_texture, character.x, character.y, WHITE);
-        }
-        // Draw all arrows
-        draw_arrows(&arrow_list);
-
-        // Draw all swords
-        draw_swords(&sword_list);
-
-        EndMode2D();
-
-        // Draw score
-        char score_text[20];
-        sprintf(score_text, "Score: %d", score);
-        DrawText(score_text, 10, 10, 30, RED);
-
-        // Draw game over screen
-        if (game_over) {
-            DrawTexture(game_over_texture, width/2 - game_over_texture.width/2, height/2 - game_over_texture.height/2, WHITE);
-            char score_text[20];
-            sprintf(score_text, "Score: %d", score);
-            DrawText(score_text, width/3+30, 30, 80, BRIGHT_RED);
-        }
-
-        EndDrawing();
-    }
-
-    UnloadTexture(character_standing_right);
-    UnloadTexture(character_standing_left);
-    UnloadTexture(character_jumping_right);
-    UnloadTexture(character_jumping_left);
-    UnloadTexture(character_walk1_right);
-    UnloadTexture(character_walk1_left);
-    UnloadTexture(character_walk2_right);
-    UnloadTexture(character_walk2_left);
-    UnloadTexture(character_crouching_right);
-    UnloadTexture(character_crouching_left);
-    UnloadTexture(floor_piece_texture);
-    UnloadTexture(platform1_texture);
-    UnloadTexture(platform2_texture);
-    UnloadTexture(background_texture);
-    UnloadTexture(arrow_texture);
-    UnloadTexture(sword_texture);
-    UnloadTexture(game_over_texture);
-    free(arrow_list.arrows);
-    free(sword_list.swords);
-
-    // Cleanup
-    StopMusicStream(background_music);
-    StopMusicStream(gameover_music);
-    UnloadMusicStream(background_music);
-    UnloadMusicStream(gameover_music);
-    CloseAudioDevice();
-
-    CloseWindow();
-    return 0;
-}
-
+#include <stdio.h>
+#include <raylib.h>
+#include <time.h> // Include time.h for time()
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "sim.h"
+#include "render.h"
+#include "asset_loader.h"
+#include "replay.h"
+#include "profiler.h"
+#include "audio.h"
+#include "autoplay.h"
+#include "pipeline.h"
+#include "rollback.h"
+#include "input.h"
+#include "governor.h"
+#include "mem.h"
+
+// Main thread time per frame for GPU uploads while loading
+#define ASSET_UPLOAD_BUDGET 0.008
+#define FRAME_RATE 60
+
+// "host:port", or just "port" for localhost
+static bool parse_peer(const char *text, char *host, int host_size, int *port) {
+    const char *colon = strrchr(text, ':');
+    if (colon == NULL) {
+        snprintf(host, host_size, "127.0.0.1");
+        *port = atoi(text);
+    } else {
+        snprintf(host, host_size, "%.*s", (int)(colon - text), text);
+        *port = atoi(colon + 1);
+    }
+    return *port > 0 && *port < 65536;
+}
+
+int main(int argc, char **argv) {
+    // Simulation rate, e.g. --tick-rate 30 on weak hardware
+    int tick_rate = SIM_TICK_RATE;
+    bool asset_report = false;
+    // A run is reproducible from its seed, printed at startup
+    uint64_t seed = (uint64_t)time(NULL);
+    const char *record_path = NULL;
+    bool autoplay = false; // The lookahead bot plays instead of the keyboard
+    // Versus over UDP (rollback.h): --versus 0|1 --port P --peer HOST:PORT
+    int versus_player = -1;
+    int port = 0;
+    const char *peer = NULL;
+    int input_delay = ROLLBACK_DEFAULT_DELAY;
+    NetConditions conditions = {0}; // Simulated network trouble, for testing
+    // Frame budget for the governor (governor.h); --quality N fixes the level instead
+    float frame_budget_ms = 1000.0f / FRAME_RATE;
+    int quality = -1;
+    const char *max_mem = NULL; // Bounded memory: all game allocations from one arena this big
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            tick_rate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (strcmp(argv[i], "--autoplay") == 0) {
+            autoplay = true;
+        } else if (strcmp(argv[i], "--asset-report") == 0) {
+            asset_report = true;
+        } else if (strcmp(argv[i], "--versus") == 0 && i + 1 < argc) {
+            versus_player = atoi(argv[++i]) != 0;
+        } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+            port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--peer") == 0 && i + 1 < argc) {
+            peer = argv[++i];
+        } else if (strcmp(argv[i], "--input-delay") == 0 && i + 1 < argc) {
+            input_delay = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--latency") == 0 && i + 1 < argc) {
+            conditions.latency_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) {
+            conditions.jitter_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--loss") == 0 && i + 1 < argc) {
+            conditions.loss = atof(argv[++i]) / 100;
+        } else if (strcmp(argv[i], "--frame-budget") == 0 && i + 1 < argc) {
+            frame_budget_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quality") == 0 && i + 1 < argc) {
+            quality = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-mem") == 0 && i + 1 < argc) {
+            max_mem = argv[++i];
+        }
+    }
+    if (tick_rate <= 0) {
+        tick_rate = SIM_TICK_RATE;
+    }
+    if (frame_budget_ms <= 0) {
+        frame_budget_ms = 1000.0f / FRAME_RATE;
+    }
+    if (quality >= QUALITY_COUNT) {
+        quality = QUALITY_COUNT - 1;
+    }
+
+    if (max_mem != NULL && !mem_limit_from_arg(max_mem)) {
+        return 1;
+    }
+
+    int width = 800 * scale_factor;
+    int height = 600 * scale_factor;
+
+    // Both games are simulated here, player 0's seed and input delay win
+    bool versus = versus_player >= 0;
+    static RollbackSession session;
+    if (versus) {
+        char host[256];
+        int peer_port;
+        if (peer == NULL || !parse_peer(peer, host, sizeof(host), &peer_port)) {
+            fprintf(stderr, "--versus needs --peer HOST:PORT\n");
+            return 1;
+        }
+        rollback_init(&session, versus_player, seed, tick_rate, width, height, input_delay);
+        if (!net_open(&session.link, port)) {
+            fprintf(stderr, "could not open UDP port %d\n", port);
+            return 1;
+        }
+        if (!net_set_peer(&session.link, host, peer_port)) {
+            fprintf(stderr, "could not resolve %s\n", host);
+            return 1;
+        }
+        net_set_conditions(&session.link, conditions, seed + versus_player);
+        printf("versus: player %d on port %d, waiting for %s:%d\n", versus_player, net_local_port(&session.link),
+               host, peer_port);
+        if (record_path != NULL) {
+            fprintf(stderr, "--record is ignored in versus mode\n");
+            record_path = NULL;
+        }
+    }
+
+    InitWindow(width, height, "Survive The Jungle");
+    SetTargetFPS(FRAME_RATE);
+
+    // Initialize audio device, with stream buffers big enough to ride out slow frames
+    InitAudioDevice();
+    SetAudioStreamBufferSizeDefault(AUDIO_STREAM_BUFFER_FRAMES);
+
+    GameState state;
+    game_init(&state, width, height, seed);
+    printf("seed %llu\n", (unsigned long long)seed);
+
+    // Every tick's input goes to the recording, replay it with ./headless --replay
+    Replay replay;
+    replay_init(&replay, seed, tick_rate, width, height);
+    static AutoPlayer bot;
+    autoplay_init(&bot, seed, 1.0f / tick_rate);
+    RenderStats render_stats = {0};
+
+    // Decode on worker threads, upload here, with a progress bar meanwhile
+    GameAssets assets;
+    AssetLoader loader;
+    asset_loader_start(&loader, &assets);
+    bool loaded = true;
+    while (!asset_loader_update(&loader, ASSET_UPLOAD_BUDGET)) {
+        if (WindowShouldClose()) {
+            loaded = false;
+            break;
+        }
+        draw_loading_screen(width, height, asset_loader_progress(&loader));
+    }
+    asset_loader_finish(&loader);
+    print_asset_report(&assets);
+
+    // Per-asset timings, and the synchronous loaders for comparison
+    if (asset_report && loaded) {
+        asset_loader_report(&loader);
+        GameAssets other;
+        if (load_assets_pack(&other, ASSET_PACK_PATH)) {
+            print_asset_report(&other);
+            unload_assets(&other);
+        }
+        load_assets_png(&other);
+        print_asset_report(&other);
+        unload_assets(&other);
+    }
+
+    // Play background music, streamed by the audio thread from here on
+    AudioThread audio;
+    if (loaded) {
+        audio_start(&audio, assets.background_music, assets.gameover_sound);
+    } else {
+        memset(&audio, 0, sizeof(audio));
+    }
+    audio_post(&audio, AUDIO_MUSIC_VOLUME, 0.5f);  // Set volume to 50%, adjust as needed
+    audio_post(&audio, AUDIO_SOUND_VOLUME, 0.5f);  // Set volume for game over music
+    audio_post(&audio, AUDIO_PLAY_MUSIC, 0);
+
+    bool gameover_music_started = false;
+    bool first_frame = true;
+
+    // Keys are polled between frames and queued with timestamps (input.h)
+    static InputQueue input_queue;
+    input_queue_init(&input_queue);
+    InputSampler sampler;
+    input_sampler_init(&sampler);
+    static InputLatency latency;
+
+    // From here the simulation runs on its own thread and this one draws
+    // the newest tick it published
+    static Pipeline pipeline;
+    if (loaded && !versus &&
+        !pipeline_start(&pipeline, &state, tick_rate, &input_queue, record_path != NULL ? &replay : NULL,
+                        autoplay ? &bot : NULL)) {
+        fprintf(stderr, "could not start the simulation thread\n");
+        loaded = false;
+    }
+
+    // In versus the simulation stays on this thread: rollbacks need both
+    // games and the inputs in one place, and a tick is cheap to redo
+    SimClock clock;
+    sim_clock_init(&clock, tick_rate);
+    InputState versus_input = {0};
+    bool jump_latched = false; // A press waits for the next tick that runs
+    double versus_press = 0;   // Press time of an input not yet simulated
+    static RenderView versus_views[2]; // Own game and the rival's, as drawn
+
+    // raylib's frame limiter sleeps without polling the keyboard; frames
+    // are paced here instead, polling while they wait
+    SetTargetFPS(0);
+    double next_frame = pipeline_now();
+
+    // Sheds optional drawing when frames run over budget
+    Governor governor;
+    governor_init(&governor, frame_budget_ms, quality >= 0 ? quality : QUALITY_FULL, quality < 0);
+
+    // Steady-state play should not touch the heap: frames that did are counted
+    long allocations = mem_allocation_count();
+    long allocating_frames = 0;
+    long frames = 0;
+
+    // Game loop
+    while (loaded && !WindowShouldClose()) {
+        input_wait(&sampler, &input_queue, next_frame);
+        double frame_start = pipeline_now();
+        next_frame = next_frame + 1.0 / FRAME_RATE > frame_start ? next_frame + 1.0 / FRAME_RATE : frame_start;
+        PROFILE_FRAME();
+        const RenderView *frame_state;
+        const RenderView *rival = NULL;
+        float alpha;
+        double press_time; // Of the key press this frame is the first to show, 0 if none
+        if (versus) {
+            if (!rollback_poll(&session, GetTime())) {
+                if (session.error != NULL) {
+                    fprintf(stderr, "versus: %s\n", session.error);
+                    break;
+                }
+                input_take(&input_queue, &versus_input, frame_start); // Keys pressed before the game starts do nothing
+                draw_waiting_screen(width, height, TextFormat("Waiting for player %d...", 1 - session.local));
+                input_sample(&sampler, &input_queue, pipeline_now());
+                continue;
+            }
+            // The ticks run now, so every key event so far applies to the first of them
+            GameState *own = &session.state.players[session.local];
+            InputFrame input = input_take(&input_queue, &versus_input, frame_start);
+            if (autoplay && !own->game_over) {
+                input = autoplay_input(&bot, own);
+            }
+            jump_latched = jump_latched || input.jump;
+            if (versus_press == 0) {
+                versus_press = versus_input.press_time;
+            }
+            press_time = 0;
+            int ticks = sim_clock_advance(&clock, GetFrameTime());
+            for (int i = 0; i < ticks; i++) {
+                input.jump = jump_latched;
+                if (!rollback_advance(&session, input, GetTime())) {
+                    break; // Waiting for the peer: the game slows rather than guess further
+                }
+                jump_latched = false;
+                press_time = versus_press;
+                versus_press = 0;
+            }
+            game_render_view(own, &versus_views[0]);
+            game_render_view(&session.state.players[1 - session.local], &versus_views[1]);
+            frame_state = &versus_views[0];
+            rival = &versus_views[1];
+            alpha = sim_clock_alpha(&clock);
+            render_stats.versus = true;
+            render_stats.rollback = session.stats;
+        } else {
+            frame_state = pipeline_acquire(&pipeline);
+            alpha = pipeline_alpha(&pipeline);
+            press_time = pipeline_press_time(&pipeline);
+        }
+
+        // Switch to the game over music, looped like the background music
+        PROFILE_BEGIN(ZONE_MUSIC);
+        if (frame_state->game_over && !gameover_music_started) {
+            audio_post(&audio, AUDIO_STOP_MUSIC, 0);
+            audio_post(&audio, AUDIO_PLAY_SOUND, 1);
+            gameover_music_started = true;
+        }
+        PROFILE_END(ZONE_MUSIC);
+
+        // F1 toggles the draw counters
+        if (input_hotkey_pressed(&sampler, KEY_F1)) {
+            render_stats.overlay = !render_stats.overlay;
+        }
+#ifdef ENABLE_PROFILER
+        // F2 toggles the profiler overlay, F3 saves the recent samples
+        if (input_hotkey_pressed(&sampler, KEY_F2)) {
+            render_stats.profiler_overlay = !render_stats.profiler_overlay;
+        }
+        if (input_hotkey_pressed(&sampler, KEY_F3)) {
+            if (profiler_export("profile.json", "profile.csv")) {
+                printf("profiler: wrote profile.json and profile.csv\n");
+            }
+        }
+#endif
+        // F4 prints the allocation counts so far
+        if (input_hotkey_pressed(&sampler, KEY_F4)) {
+            mem_report();
+        }
+        input_clear_hotkeys(&sampler);
+
+        render_stats.frame_ms = GetFrameTime() * 1000.0f;
+        pipeline_stats(&pipeline, &render_stats.pipeline);
+        render_stats.input_latency_ms = latency.last_ms;
+        render_stats.input_latency_p99_ms = render_stats.overlay ? input_latency_percentile(&latency, 99) : 0;
+        render_stats.input_presses = latency.count;
+        render_stats.quality = governor.level;
+        render_stats.busy_p90_ms = governor.last_p90_ms;
+        render_stats.budget_ms = governor.budget_ms;
+        draw_game(frame_state, rival, &assets, alpha, &render_stats);
+
+        // The buffer swap ends the input-to-photon time, and EndDrawing() polled the keyboard
+        double shown = pipeline_now();
+        if (press_time > 0) {
+            input_latency_add(&latency, shown - press_time);
+        }
+        input_sample(&sampler, &input_queue, shown);
+        governor_frame(&governor, (float)((pipeline_now() - frame_start) * 1000));
+        if (first_frame && asset_report) {
+            printf("first game frame at %.1f ms\n", GetTime() * 1000.0);
+        }
+        if (!first_frame && mem_allocation_count() != allocations) {
+            allocating_frames++;
+        }
+        allocations = mem_allocation_count();
+        frames++;
+        first_frame = false;
+    }
+
+    // The simulation thread's state is the final one
+    pipeline_stop(&pipeline);
+    if (versus) {
+        rollback_report(&session);
+        const GameState *own = &session.state.players[session.local];
+        const GameState *other = &session.state.players[1 - session.local];
+        if (rollback_match_over(&session)) {
+            const char *result = own->score > other->score ? "won" : own->score < other->score ? "lost" : "draw";
+            printf("versus: %s, %d to %d\n", result, own->score, other->score);
+        }
+        net_close(&session.link);
+    } else if (loaded) {
+        state = pipeline.state;
+        PipelineStats stats;
+        pipeline_stats(&pipeline, &stats);
+        printf("pipeline: %ld ticks (%ld late, %ld dropped, %ld never drawn), %ld frames (%ld without a new tick)\n",
+               stats.ticks, stats.late_ticks, stats.dropped_ticks, stats.unseen_ticks, stats.frames,
+               stats.stale_frames);
+    }
+    if (record_path != NULL) {
+        if (replay_save(&replay, record_path, &state)) {
+            printf("recorded %u ticks to %s (%u bytes of input)\n", replay.header.tick_count, record_path,
+                   replay.header.input_size);
+        } else {
+            perror(record_path);
+        }
+    }
+    if (loaded) {
+        input_report(&sampler, &input_queue, &latency);
+        governor_report(&governor);
+        printf("mem: %ld of %ld frames after the first allocated\n", allocating_frames, frames > 0 ? frames - 1 : 0);
+    }
+    mem_report();
+    replay_free(&replay);
+    if (autoplay) {
+        autoplay_report(&bot);
+    }
+
+    // Cleanup
+    audio_stop(&audio);
+    unload_render_cache();
+    unload_assets(&assets);
+    CloseAudioDevice();
+
+    CloseWindow();
+    return 0;
+}
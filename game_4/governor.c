@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "governor.h"
+
+const char *quality_names[QUALITY_COUNT] = {
+    [QUALITY_FULL] = "full",
+    [QUALITY_CACHED_HUD] = "cached hud",
+    [QUALITY_COARSE_BACKGROUND] = "coarse background",
+    [QUALITY_MINIMAL] = "minimal",
+};
+
+void governor_init(Governor *governor, float budget_ms, QualityLevel level, bool adaptive) {
+    memset(governor, 0, sizeof(*governor));
+    governor->budget_ms = budget_ms;
+    governor->adaptive = adaptive;
+    governor->level = level;
+    governor->restore_windows = GOVERNOR_RESTORE_WINDOWS;
+}
+
+static int compare_floats(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+static void decide(Governor *governor, float p90_ms) {
+    float budget = governor->budget_ms;
+    bool restored = governor->restored;
+    governor->restored = false;
+
+    if (p90_ms > budget * GOVERNOR_SHED_RATIO) {
+        governor->calm_windows = 0;
+        if (governor->level == QUALITY_COUNT - 1) {
+            // Said once; nothing changes until a restore
+            if (!governor->at_floor) {
+                printf("governor: p90 %.2f ms of %.2f ms budget, nothing left to shed at %s\n", p90_ms, budget,
+                       quality_names[governor->level]);
+                governor->at_floor = true;
+            }
+            return;
+        }
+        governor->level++;
+        governor->sheds++;
+        printf("governor: p90 %.2f ms over %.0f%% of %.2f ms budget, shedding to %s\n", p90_ms,
+               GOVERNOR_SHED_RATIO * 100, budget, quality_names[governor->level]);
+        // Restoring did not fit, so wait longer before trying again
+        if (restored && governor->restore_windows < GOVERNOR_RESTORE_WINDOWS_MAX) {
+            governor->restore_windows *= 2;
+            printf("governor: restore did not hold, next one after %d calm windows\n", governor->restore_windows);
+        }
+        return;
+    }
+
+    if (p90_ms >= budget * GOVERNOR_RESTORE_RATIO || governor->level == QUALITY_FULL) {
+        governor->calm_windows = 0;
+        return;
+    }
+    governor->calm_windows++;
+    if (governor->calm_windows < governor->restore_windows) {
+        return;
+    }
+    governor->calm_windows = 0;
+    governor->level--;
+    governor->restores++;
+    governor->at_floor = false;
+    governor->restored = true;
+    printf("governor: p90 %.2f ms under %.0f%% of %.2f ms budget for %d windows, restoring to %s\n", p90_ms,
+           GOVERNOR_RESTORE_RATIO * 100, budget, governor->restore_windows, quality_names[governor->level]);
+}
+
+// busy_ms is the frame's time on the main thread, without the wait for the
+// next frame
+void governor_frame(Governor *governor, float busy_ms) {
+    governor->frames++;
+    governor->level_frames[governor->level]++;
+    governor->window[governor->count++] = busy_ms;
+    if (governor->count < GOVERNOR_WINDOW) {
+        return;
+    }
+    governor->count = 0;
+
+    float sorted[GOVERNOR_WINDOW];
+    memcpy(sorted, governor->window, sizeof(sorted));
+    qsort(sorted, GOVERNOR_WINDOW, sizeof(float), compare_floats);
+    governor->last_p90_ms = sorted[GOVERNOR_WINDOW * 9 / 10];
+    if (governor->adaptive) {
+        decide(governor, governor->last_p90_ms);
+    }
+}
+
+void governor_report(const Governor *governor) {
+    printf("governor: %ld frames, %ld sheds, %ld restores, %.2f ms budget\n", governor->frames, governor->sheds,
+           governor->restores, governor->budget_ms);
+    for (int level = 0; level < QUALITY_COUNT; level++) {
+        if (governor->level_frames[level] > 0) {
+            printf("  %-18s %5.1f%% of frames\n", quality_names[level],
+                   100.0 * governor->level_frames[level] / governor->frames);
+        }
+    }
+}
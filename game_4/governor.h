@@ -0,0 +1,56 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+// Frame-budget governor. Each frame reports how long the main thread was
+// busy with it, pacing sleeps left out. Every GOVERNOR_WINDOW frames the
+// window's 90th percentile is compared with the budget: over
+// GOVERNOR_SHED_RATIO of it, rendering drops one quality level; under
+// GOVERNOR_RESTORE_RATIO for enough windows in a row, it gets one back.
+// A restore that is shed again straight away doubles the calm windows the
+// next restore needs, so a machine on the edge does not flicker between
+// two levels. Every decision is printed with the numbers behind it.
+//
+// Only optional work is shed; the simulation and what it draws are the
+// same at every level.
+
+#include <stdbool.h>
+
+#define GOVERNOR_WINDOW 30               // Frames per decision
+#define GOVERNOR_SHED_RATIO 0.9f         // Of the budget
+#define GOVERNOR_RESTORE_RATIO 0.5f      // Of the budget
+#define GOVERNOR_RESTORE_WINDOWS 4       // Calm windows before a restore, at first
+#define GOVERNOR_RESTORE_WINDOWS_MAX 64
+
+// Each level sheds what the one above it does, and more
+typedef enum {
+    QUALITY_FULL,
+    QUALITY_CACHED_HUD,        // The HUD is redrawn only when what it shows changes
+    QUALITY_COARSE_BACKGROUND, // The background scrolls in whole steps and is drawn without blending
+    QUALITY_MINIMAL,           // No background picture, no rival ghost
+    QUALITY_COUNT,
+} QualityLevel;
+
+extern const char *quality_names[QUALITY_COUNT];
+
+typedef struct {
+    float budget_ms;
+    bool adaptive; // false keeps the level it started at
+    QualityLevel level;
+    float window[GOVERNOR_WINDOW]; // Busy milliseconds of this window's frames
+    int count;
+    int calm_windows;    // In a row, under the restore ratio
+    int restore_windows; // Needed for the next restore
+    bool restored;       // The last decision was a restore, one window ago
+    bool at_floor;       // Over budget with nothing left to shed, logged until the next restore
+    float last_p90_ms;   // Of the last full window
+    long frames;
+    long level_frames[QUALITY_COUNT];
+    long sheds;
+    long restores;
+} Governor;
+
+void governor_init(Governor *governor, float budget_ms, QualityLevel level, bool adaptive);
+void governor_frame(Governor *governor, float busy_ms);
+void governor_report(const Governor *governor);
+
+#endif
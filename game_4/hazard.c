@@ -0,0 +1,305 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "hazard.h"
+#include "mem.h"
+
+HazardTable hazards;
+
+static bool loaded = false;
+static const char *source = "built-in";
+
+// Used when hazards.cfg is missing; the same hazards the shipped file describes
+static const char builtin_hazards[] =
+    "[arrow]\n"
+    "sprite arrow\n"
+    "speed 300 60 10\n"
+    "every 2.3\n"
+    "[sword]\n"
+    "sprite sword\n"
+    "speed 420 60 10\n"
+    "every 10\n";
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+static void hash_type(uint64_t *hash, const HazardType *type) {
+    *hash = hash_bytes(*hash, type->name, strlen(type->name));
+    *hash = hash_bytes(*hash, &type->sprite, sizeof(type->sprite));
+    *hash = hash_bytes(*hash, &type->pixel_hits, sizeof(type->pixel_hits));
+    *hash = hash_bytes(*hash, &type->speed, sizeof(type->speed));
+    *hash = hash_bytes(*hash, &type->speed_gain, sizeof(type->speed_gain));
+    *hash = hash_bytes(*hash, &type->speed_step, sizeof(type->speed_step));
+    *hash = hash_bytes(*hash, &type->spawn, sizeof(type->spawn));
+    *hash = hash_bytes(*hash, &type->min_score, sizeof(type->min_score));
+    *hash = hash_bytes(*hash, &type->first, sizeof(type->first));
+    *hash = hash_bytes(*hash, &type->interval, sizeof(type->interval));
+    *hash = hash_bytes(*hash, &type->wave_count, sizeof(type->wave_count));
+    *hash = hash_bytes(*hash, &type->wave_gap, sizeof(type->wave_gap));
+    *hash = hash_bytes(*hash, &type->ramp_every, sizeof(type->ramp_every));
+    *hash = hash_bytes(*hash, &type->ramp_factor, sizeof(type->ramp_factor));
+    *hash = hash_bytes(*hash, &type->ramp_min, sizeof(type->ramp_min));
+}
+
+// Checks a finished section; returns an error message or NULL
+static const char *finish_type(HazardType *type) {
+    if ((int)type->sprite < 0) {
+        return "no sprite";
+    }
+    if (type->interval <= 0) {
+        return "no interval (every SECONDS)";
+    }
+    if (type->first < 0) {
+        type->first = type->interval;
+    }
+    if (type->speed <= 0) {
+        return "no speed (speed PIXELS_PER_SECOND)";
+    }
+    if (type->speed_gain != 0 && type->speed_step < 1) {
+        return "speed step must be at least 1";
+    }
+    if (type->ramp_every > 0 && (type->ramp_factor <= 0 || type->ramp_min <= 0)) {
+        return "ramp factor and minimum must be positive";
+    }
+    return NULL;
+}
+
+// Parse hazards.cfg text into table. On failure writes "source:line:
+// message" to error and returns false; table is then incomplete.
+bool hazards_parse(HazardTable *table, const char *text, const char *source_name, char *error, int error_size) {
+    memset(table, 0, sizeof(*table));
+    HazardType *type = NULL;
+    const char *problem = NULL;
+    char line[256];
+    int line_number = 0;
+    const char *cursor = text;
+    while (*cursor != '\0' && problem == NULL) {
+        // Copy one line, dropping the newline and any comment
+        size_t length = strcspn(cursor, "\r\n");
+        size_t copied = length < sizeof(line) - 1 ? length : sizeof(line) - 1;
+        memcpy(line, cursor, copied);
+        line[copied] = '\0';
+        cursor += length;
+        if (*cursor == '\r') {
+            cursor++;
+        }
+        if (*cursor == '\n') {
+            cursor++;
+        }
+        line_number++;
+        char *comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+
+        char key[32], word[32];
+        if (sscanf(line, " %31s", key) != 1) {
+            continue; // Blank
+        }
+
+        if (key[0] == '[') {
+            if (type != NULL && (problem = finish_type(type)) != NULL) {
+                break;
+            }
+            if (table->count == HAZARD_MAX_TYPES) {
+                problem = "too many hazard types";
+                break;
+            }
+            type = &table->types[table->count++];
+            *type = (HazardType){.sprite = -1, .pixel_hits = true, .first = -1, .wave_count = 1,
+                                 .ramp_factor = 1, .ramp_min = 0};
+            char *end = strchr(line, ']');
+            char *start = strchr(line, '[') + 1;
+            if (end == NULL || end == start) {
+                problem = "expected [name]";
+                break;
+            }
+            *end = '\0';
+            snprintf(type->name, sizeof(type->name), "%s", start);
+            continue;
+        }
+        if (type == NULL) {
+            problem = "expected [name] before the first setting";
+            break;
+        }
+
+        const char *values = strstr(line, key) + strlen(key);
+        if (strcmp(key, "sprite") == 0) {
+            problem = "unknown sprite";
+            if (sscanf(values, "%31s", word) == 1) {
+                for (int kind = 0; kind < PROJECTILE_KIND_COUNT; kind++) {
+                    if (strcmp(word, projectile_types[kind].name) == 0) {
+                        type->sprite = (ProjectileKind)kind;
+                        problem = NULL;
+                    }
+                }
+            }
+        } else if (strcmp(key, "hitbox") == 0) {
+            if (sscanf(values, "%31s", word) == 1 && (strcmp(word, "mask") == 0 || strcmp(word, "box") == 0)) {
+                type->pixel_hits = strcmp(word, "mask") == 0;
+            } else {
+                problem = "hitbox must be mask or box";
+            }
+        } else if (strcmp(key, "speed") == 0) {
+            int read = sscanf(values, "%f %f %d", &type->speed, &type->speed_gain, &type->speed_step);
+            if ((read != 1 && read != 3) || type->speed <= 0) {
+                problem = "expected speed PIXELS_PER_SECOND [GAIN EVERY_POINTS]";
+            }
+        } else if (strcmp(key, "spawn") == 0) {
+            if (sscanf(values, "%31s", word) != 1) {
+                problem = "expected spawn random|floor|aimed";
+            } else if (strcmp(word, "random") == 0) {
+                type->spawn = SPAWN_RANDOM;
+            } else if (strcmp(word, "floor") == 0) {
+                type->spawn = SPAWN_FLOOR;
+            } else if (strcmp(word, "aimed") == 0) {
+                type->spawn = SPAWN_AIMED;
+            } else {
+                problem = "expected spawn random|floor|aimed";
+            }
+        } else if (strcmp(key, "after") == 0) {
+            if (sscanf(values, "%d", &type->min_score) != 1) {
+                problem = "expected after SCORE";
+            }
+        } else if (strcmp(key, "first") == 0) {
+            if (sscanf(values, "%f", &type->first) != 1 || type->first < 0) {
+                problem = "expected first SECONDS";
+            }
+        } else if (strcmp(key, "every") == 0) {
+            if (sscanf(values, "%f", &type->interval) != 1 || type->interval <= 0) {
+                problem = "expected every SECONDS";
+            }
+        } else if (strcmp(key, "wave") == 0) {
+            int read = sscanf(values, "%d %f", &type->wave_count, &type->wave_gap);
+            if (read < 1 || type->wave_count < 1 || type->wave_count > UINT16_MAX || type->wave_gap < 0 ||
+                (type->wave_count > 1 && read != 2)) {
+                problem = "expected wave COUNT [GAP_SECONDS]";
+            }
+        } else if (strcmp(key, "ramp") == 0) {
+            if (sscanf(values, "%f %f %f", &type->ramp_every, &type->ramp_factor, &type->ramp_min) != 3 ||
+                type->ramp_every <= 0) {
+                problem = "expected ramp EVERY_SECONDS FACTOR MIN_INTERVAL";
+            }
+        } else {
+            problem = "unknown setting";
+        }
+    }
+    if (problem == NULL && type != NULL) {
+        problem = finish_type(type);
+    }
+    if (problem == NULL && table->count == 0) {
+        problem = "no hazards";
+    }
+    if (problem != NULL) {
+        snprintf(error, error_size, "%s:%d: %s", source_name, line_number, problem);
+        return false;
+    }
+
+    table->hash = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < table->count; i++) {
+        hash_type(&table->hash, &table->types[i]);
+    }
+    return true;
+}
+
+// Replace the table with the file's; on any error print it and keep the current one
+bool hazards_load(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fileno(file), &info) != 0) {
+        perror(path);
+        fclose(file);
+        return false;
+    }
+    if (!S_ISREG(info.st_mode)) {
+        fprintf(stderr, "%s: not a regular file\n", path);
+        fclose(file);
+        return false;
+    }
+    if (info.st_size > HAZARDS_MAX_FILE_SIZE) {
+        fprintf(stderr, "%s: over %d bytes\n", path, HAZARDS_MAX_FILE_SIZE);
+        fclose(file);
+        return false;
+    }
+    size_t size = (size_t)info.st_size;
+    char *text = (char *)mem_alloc(MEM_HAZARDS, size + 1);
+    if (text == NULL) {
+        fclose(file);
+        return false;
+    }
+    size_t read = fread(text, 1, size, file);
+    bool read_ok = !ferror(file);
+    fclose(file);
+    if (!read_ok) {
+        perror(path);
+        mem_free(text);
+        return false;
+    }
+    text[read] = '\0';
+
+    HazardTable *table = (HazardTable *)mem_alloc(MEM_HAZARDS, sizeof(HazardTable));
+    if (table == NULL) {
+        mem_free(text);
+        return false;
+    }
+    char error[256];
+    bool ok = hazards_parse(table, text, path, error, sizeof(error));
+    if (ok) {
+        hazards = *table;
+        source = path;
+    } else {
+        fprintf(stderr, "%s\n", error);
+    }
+    mem_free(table);
+    mem_free(text);
+    return ok;
+}
+
+// Load the hazard table once: GAME_HAZARDS, else hazards.cfg if present,
+// else the built-in one
+void hazards_init(void) {
+    if (loaded) {
+        return;
+    }
+    loaded = true;
+    char error[256];
+    if (!hazards_parse(&hazards, builtin_hazards, "built-in", error, sizeof(error))) {
+        fprintf(stderr, "%s\n", error);
+    }
+
+    const char *path = getenv("GAME_HAZARDS");
+    if (path == NULL) {
+        FILE *file = fopen(HAZARDS_PATH, "rb");
+        if (file == NULL) {
+            return;
+        }
+        fclose(file);
+        path = HAZARDS_PATH;
+    }
+    if (!hazards_load(path)) {
+        fprintf(stderr, "using the built-in hazards\n");
+    }
+}
+
+// Where the current table came from, a path or "built-in"
+const char *hazards_source(void) {
+    return source;
+}
+
+float hazard_speed(const HazardType *type, int score) {
+    if (type->speed_gain == 0) {
+        return type->speed;
+    }
+    return type->speed + score / type->speed_step * type->speed_gain;
+}
@@ -0,0 +1,75 @@
+#ifndef HAZARD_H
+#define HAZARD_H
+
+// Hazard types: what the game throws at the character and when. Each type
+// names the projectile sprite it flies as and says how fast it moves, how
+// high it spawns, how often its waves come and how that ramps up. The table
+// is read from hazards.cfg at startup (see that file for the format) and
+// falls back to the built-in arrows and swords when the file is missing.
+// GAME_HAZARDS=FILE reads another file.
+//
+// The table is shared read-only by every GameState; a game only stores its
+// per-type progress (HazardState) and the pool slots store a type index.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "projectile.h"
+
+#define HAZARDS_PATH "hazards.cfg"
+#define HAZARDS_MAX_FILE_SIZE (64 * 1024) // Bytes; anything bigger is not a hazards.cfg
+#define HAZARD_MAX_TYPES 254 // Pool slots store the index in a byte, PROJECTILE_NONE marks free ones
+#define HAZARD_NAME_SIZE 24
+
+// Where a wave's projectiles appear at the right edge of the screen
+typedef enum {
+    SPAWN_RANDOM, // Anywhere above the floor
+    SPAWN_FLOOR,  // On the floor, to be jumped over
+    SPAWN_AIMED,  // Level with the character's middle
+} HazardSpawn;
+
+typedef struct {
+    char name[HAZARD_NAME_SIZE];
+    ProjectileKind sprite; // Picks the texture, size and hitmask
+    bool pixel_hits;       // Test the hitmask, not just its bounding box
+
+    // Speed in pixels per second: speed, plus speed_gain for every speed_step points scored
+    float speed;
+    float speed_gain;
+    int speed_step;
+
+    HazardSpawn spawn;
+    int min_score;  // No waves before the score reaches this
+    float first;    // Seconds from the start to the first wave
+    float interval; // Seconds between waves
+    int wave_count; // Projectiles per wave
+    float wave_gap; // Seconds between the projectiles of a wave
+
+    // Difficulty ramp: every ramp_every seconds (0 = never) the interval is
+    // multiplied by ramp_factor, down to ramp_min
+    float ramp_every;
+    float ramp_factor;
+    float ramp_min;
+} HazardType;
+
+typedef struct {
+    int count;
+    HazardType types[HAZARD_MAX_TYPES];
+    uint64_t hash; // Of the parsed values, to tell tables apart
+} HazardTable;
+
+// Per-game progress of a hazard type
+typedef struct {
+    float interval;      // Seconds between waves, after ramps
+    uint16_t wave_left;  // Projectiles of the current wave still to spawn
+} HazardState;
+
+extern HazardTable hazards;
+
+void hazards_init(void);
+bool hazards_parse(HazardTable *table, const char *text, const char *source, char *error, int error_size);
+bool hazards_load(const char *path);
+const char *hazards_source(void);
+float hazard_speed(const HazardType *type, int score);
+
+#endif
@@ -0,0 +1,41 @@
+#include "hitmask.h"
+
+// 64 pixels of a mask row starting at pixel x, which may lie partly or
+// wholly outside the row; pixels outside are empty
+static uint64_t row_bits(const uint64_t *row, int words, int x) {
+    int word = x >> 6; // Floor division, x may be negative
+    int shift = x & 63;
+    uint64_t low = word >= 0 && word < words ? row[word] : 0;
+    if (shift == 0) {
+        return low;
+    }
+    uint64_t high = word + 1 >= 0 && word + 1 < words ? row[word + 1] : 0;
+    return low >> shift | high << (64 - shift);
+}
+
+// Whether a placed with its top left pixel at (ax, ay) and b at (bx, by)
+// share a solid pixel. Only rows and words inside both solid bounding
+// boxes are visited.
+bool hitmask_overlap(const HitMask *a, int ax, int ay, const HitMask *b, int bx, int by) {
+    int y0 = ay + a->y0 > by + b->y0 ? ay + a->y0 : by + b->y0;
+    int y1 = ay + a->y1 < by + b->y1 ? ay + a->y1 : by + b->y1;
+    int x0 = ax + a->x0 > bx + b->x0 ? ax + a->x0 : bx + b->x0;
+    int x1 = ax + a->x1 < bx + b->x1 ? ax + a->x1 : bx + b->x1;
+    if (y0 >= y1 || x0 >= x1) {
+        return false;
+    }
+
+    // Walk a's words covering [x0, x1), lining b's bits up with each
+    int first_word = (x0 - ax) >> 6;
+    int last_word = (x1 - 1 - ax) >> 6;
+    for (int y = y0; y < y1; y++) {
+        const uint64_t *a_row = a->rows + (y - ay) * a->words;
+        const uint64_t *b_row = b->rows + (y - by) * b->words;
+        for (int w = first_word; w <= last_word; w++) {
+            if (a_row[w] & row_bits(b_row, b->words, ax + w * 64 - bx)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,50 @@
+#ifndef HITMASK_H
+#define HITMASK_H
+
+// Pixel-accurate hitboxes. Each sprite the simulation collides has its alpha
+// channel baked offline (make bake-hitmasks, see tools/hitmasks.c) into
+// hitmask_data.c: one bit per pixel, packed into 64-bit words per row, bit
+// i of word w being pixel x = w * 64 + i. Two masks overlap if any row
+// pair ANDs to nonzero once one row is shifted by their x distance.
+//
+// The data is compiled in, so the simulation and the headless tools need
+// no image decoder and collide exactly like the game.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HITMASK_ALPHA_THRESHOLD 128 // Pixels at least this opaque are solid
+
+typedef enum {
+    HITMASK_ARROW,
+    HITMASK_SWORD,
+    HITMASK_STANDING_RIGHT,
+    HITMASK_STANDING_LEFT,
+    HITMASK_WALK1_RIGHT,
+    HITMASK_WALK1_LEFT,
+    HITMASK_WALK2_RIGHT,
+    HITMASK_WALK2_LEFT,
+    HITMASK_JUMPING_RIGHT,
+    HITMASK_JUMPING_LEFT,
+    HITMASK_CROUCHING_RIGHT,
+    HITMASK_CROUCHING_LEFT,
+    HITMASK_COUNT,
+} HitMaskId;
+
+typedef struct {
+    int width;  // Sprite size in pixels
+    int height;
+    int words;  // 64-bit words per row
+    // Bounding box of the solid pixels, x1 and y1 exclusive; the broad phase tests this
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+    const uint64_t *rows; // height * words
+} HitMask;
+
+extern const HitMask hitmasks[HITMASK_COUNT];
+
+bool hitmask_overlap(const HitMask *a, int ax, int ay, const HitMask *b, int bx, int by);
+
+#endif
@@ -0,0 +1,1752 @@
+// Generated by tools/hitmasks.c (make bake-hitmasks) from the sprites in img/.
+// Do not edit; see hitmask.h for the layout.
+
+#include "hitmask.h"
+
+// img/arrow4.png, 255x90
+static const uint64_t arrow_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003ec000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000001fffc0000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000000fffff800ULL,
+    0x0001c00000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000007ffffffeULL,
+    0x0000f80000000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL, 0x000000003fffffffULL,
+    0x0000ff8000000000ULL, 0x0000000000000000ULL, 0xc000000000000000ULL, 0x000000001fffffffULL,
+    0x00007ff000000000ULL, 0x0000000000000000ULL, 0xe000000000000000ULL, 0x000000000fffffffULL,
+    0x00003ffe00000000ULL, 0x0000000000000000ULL, 0xf800000000000000ULL, 0x0000007fffffffffULL,
+    0x001f3fffe0000000ULL, 0x0000000000000000ULL, 0xfc00000000000000ULL, 0x0000007fffffffffULL,
+    0x001ffffffc000000ULL, 0x4000000000000000ULL, 0xffffffffffffffffULL, 0x000000ffffffffffULL,
+    0xffffffffffc00000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000007fffffffffULL,
+    0xfffffffffff80000ULL, 0xffffffffffffffffULL, 0xfe0003ffffffffffULL, 0x0000003fffffffffULL,
+    0xfffffffffff00000ULL, 0x000000000000007fULL, 0xfc00000000000000ULL, 0x0000000003ffffffULL,
+    0x000fffffff800000ULL, 0x0000000000000000ULL, 0xf800000000000000ULL, 0x0000000007ffffffULL,
+    0x000fdffffc000000ULL, 0x0000000000000000ULL, 0xf000000000000000ULL, 0x000000000fffffffULL,
+    0x00001fffe0000000ULL, 0x0000000000000000ULL, 0xe000000000000000ULL, 0x000000001fffffffULL,
+    0x00001ffe00000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL, 0x000000003fffffffULL,
+    0x00001ff000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000003ffffff8ULL,
+    0x00003f8000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000007fff0000ULL,
+    0x00003c0000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000000fd000000ULL,
+    0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+};
+
+// img/sward.png, 344x110
+static const uint64_t sword_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0007800000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0007f00000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0003ff0000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0003ffe000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0003ffff00000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0003ffffe0000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1003fffffe000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x300fffffffe00000ULL, 0x0000000000000007ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xf01fffffffff0000ULL,
+    0x00000000000000ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xf01ffffffffffe00ULL, 0x00000000000001ffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xf01ffffffffffffeULL,
+    0x00000000000001ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffff000000000000ULL, 0xf83fffffffffffffULL, 0x00000000000000ffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffff00000000ULL, 0xffffffffffffffffULL,
+    0x00000000000001ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffc0ULL, 0xffffffffffffffffULL, 0x80000000000003ffULL, 0x0000000000000007ULL,
+    0x0000000000000000ULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xc00000000001ffffULL, 0x000000000000001fULL, 0xfffffffffe000000ULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffc00000001fffffULL, 0x000000000000003fULL,
+    0xffffffffffff0000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xfffe0001ffffffffULL, 0x00000000000000ffULL, 0xfffffffffffff800ULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000001ffULL,
+    0xffffffffffffff80ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0x00000000000003ffULL, 0xfffffffffffffff0ULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000000000000fffULL,
+    0xffffffffffffffe0ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0x00000000000003ffULL, 0xffffffffffffff00ULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000001ffULL,
+    0xffffffffffffe000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xfffffffffff80000ULL, 0xffffffffffffffffULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffe0000001ffffffULL, 0x000000000000003fULL,
+    0xffffffff80000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+    0xc00000000007ffffULL, 0x000000000000001fULL, 0x0000000000000000ULL, 0xfffffffc00000000ULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x800000000000c3ffULL, 0x000000000000000fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffff8000ULL, 0xffffffffffffffffULL,
+    0x00000000000001ffULL, 0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffe0000000000ULL, 0xf87fffffffffffffULL, 0x00000000000000ffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfe00000000000000ULL, 0xf03fffffffffffffULL,
+    0x00000000000000ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xf01ffffffffffff0ULL, 0x00000000000001ffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xf01ffffffffff000ULL,
+    0x00000000000000ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xb00ffffffffc0000ULL, 0x000000000000000fULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1003ffffffc00000ULL,
+    0x0000000000000006ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x1001fffffc000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0003ffffc0000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0003fffc00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0003ffc000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0003fc0000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0007e00000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0006000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+};
+
+// img/standing.png, 101x260
+static const uint64_t standing_right_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x07ffe00000000000ULL, 0x0000000000000000ULL,
+    0x07ffc00000000000ULL, 0x0000000000000000ULL, 0x7fffff0000000000ULL, 0x0000000000000000ULL,
+    0xffffff0000000000ULL, 0x0000000000000001ULL, 0xfffffff000000000ULL, 0x000000000000003fULL,
+    0xfffffff000000000ULL, 0x00000000000000ffULL, 0xfffffffe00000000ULL, 0x00000000000003ffULL,
+    0xffffffff00000000ULL, 0x00000000000007ffULL, 0xffffffff00000000ULL, 0x00000000000007ffULL,
+    0xffffffffc0000000ULL, 0x0000000000001fffULL, 0xffffffffc0000000ULL, 0x0000000000007fffULL,
+    0xfffffffff0000000ULL, 0x0000000000007fffULL, 0xfffffffff0000000ULL, 0x000000000000ffffULL,
+    0xfffffffffc000000ULL, 0x000000000000ffffULL, 0xfffffffffc000000ULL, 0x000000000003ffffULL,
+    0xfffffffffe000000ULL, 0x000000000003ffffULL, 0xfffffffffc000000ULL, 0x000000000007ffffULL,
+    0xfffffffffc000000ULL, 0x000000000007ffffULL, 0xffffffffff000000ULL, 0x00000000001fffffULL,
+    0xffffffffff000000ULL, 0x00000000001fffffULL, 0xffffffffff000000ULL, 0x00000000003fffffULL,
+    0xffffffffff000000ULL, 0x00000000003fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff000000ULL, 0x00000000007fffffULL,
+    0xffffffffff000000ULL, 0x00000000007fffffULL, 0xffffffffff800000ULL, 0x00000000007fffffULL,
+    0xfffffffffe000000ULL, 0x00000000007fffffULL, 0xfffffffffe000000ULL, 0x00000000007fffffULL,
+    0xfffffffffe000000ULL, 0x000000000079ffffULL, 0xfffffffffe000000ULL, 0x0000000000307fffULL,
+    0xfffffffff8000000ULL, 0x0000000000107fffULL, 0xfffffffff8000000ULL, 0x0000000000007fffULL,
+    0xfffffffff8000000ULL, 0x0000000000003fffULL, 0xfffffffff8000000ULL, 0x0000000000003fffULL,
+    0xfffffffff0000000ULL, 0x0000000000003fffULL, 0xfffffffff0000000ULL, 0x0000000000003fffULL,
+    0xffffffffe0000000ULL, 0x0000000000003fffULL, 0xffffffffc0000000ULL, 0x0000000000003fffULL,
+    0xffffffffc0000000ULL, 0x0000000000003fffULL, 0xfffffffe00000000ULL, 0x0000000000003fffULL,
+    0xfffffffe00000000ULL, 0x0000000000003fffULL, 0xfffffff000000000ULL, 0x0000000000003fffULL,
+    0xfffffc0000000000ULL, 0x0000000000003fffULL, 0xfffffc0000000000ULL, 0x0000000000003fffULL,
+    0xfffffc0000000000ULL, 0x0000000000003fffULL, 0xfffffc0000000000ULL, 0x0000000000000fffULL,
+    0xfffffc03ff000000ULL, 0x0000000000000fffULL, 0xfffffe07ffa00000ULL, 0x0000000000000fffULL,
+    0xffffffffffe00000ULL, 0x00000000000007ffULL, 0xfffffffffff00000ULL, 0x00000000000007ffULL,
+    0xfffffffffffa0000ULL, 0x00000000000003ffULL, 0xfffffffffffe0000ULL, 0x00000000000001ffULL,
+    0xfffffffffffe0000ULL, 0x00000000000000ffULL, 0xfffffffffffe0000ULL, 0x00000000000000ffULL,
+    0xffffffffffff8000ULL, 0x000000000000003fULL, 0x3fffffffffff8000ULL, 0x0000000000000000ULL,
+    0x3fffffffffff8000ULL, 0x0000000000000000ULL, 0xffffffffffff8000ULL, 0x0000000000000001ULL,
+    0xffffffffffff8000ULL, 0x0000000000000005ULL, 0xffffffffffff8000ULL, 0x0000000000000007ULL,
+    0xffffffffffff8000ULL, 0x000000000000000fULL, 0xffffffffffffc000ULL, 0x000000000000000fULL,
+    0xffffffffffffc000ULL, 0x000000000000001fULL, 0xffffffffffffc000ULL, 0x000000000000003fULL,
+    0xffffffffffffc000ULL, 0x000000000000007fULL, 0xffffffffffffc000ULL, 0x000000000000007fULL,
+    0xffffffffffffc000ULL, 0x000000000000007fULL, 0xffffffffffff8000ULL, 0x000000000000007fULL,
+    0xffffffffffff8000ULL, 0x000000000000007fULL, 0xffffffffffffc000ULL, 0x000000000000007fULL,
+    0xffffffffffffc000ULL, 0x000000000000007fULL, 0xffffffffffffc000ULL, 0x000000000000007fULL,
+    0xffffffffffffc000ULL, 0x00000000000003ffULL, 0xffffffffffffc000ULL, 0x00000000000001ffULL,
+    0xfffffffffffff000ULL, 0x00000000000001ffULL, 0xffffffffffffe000ULL, 0x00000000000001ffULL,
+    0xffffffffffffe000ULL, 0x00000000000001ffULL, 0xfffffffffffff000ULL, 0x00000000000001ffULL,
+    0xfffffffffffff800ULL, 0x00000000000001ffULL, 0xfffffffffffff800ULL, 0x00000000000001ffULL,
+    0xfffffffffffff800ULL, 0x00000000000001ffULL, 0xfffffffffffffc00ULL, 0x00000000000001ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000001ffULL, 0xfffffffffffffe00ULL, 0x00000000000001ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000001ffULL, 0xfffffffffffffe00ULL, 0x00000000000001ffULL,
+    0xffffffffffffff00ULL, 0x00000000000001ffULL, 0xffffffffffffff80ULL, 0x00000000000001ffULL,
+    0xffffffffffffff80ULL, 0x00000000000003ffULL, 0xffffffffffffff80ULL, 0x00000000000003ffULL,
+    0xffffffffffffffe0ULL, 0x00000000000003ffULL, 0xffffffffffffffe0ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000003ffULL, 0xfffffffffffffff8ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000003ffULL, 0xfffffffffffffffcULL, 0x00000000000003ffULL,
+    0xfffffffffffffffcULL, 0x00000000000003ffULL, 0xfffffffffffffffcULL, 0x00000000000003ffULL,
+    0xffffffffffffffffULL, 0x00000000000003ffULL, 0xffffffffffffffffULL, 0x00000000000003ffULL,
+    0xffffffffffffffffULL, 0x00000000000003ffULL, 0xffffffffffffffffULL, 0x00000000000003ffULL,
+    0xffffffffffffffffULL, 0x00000000000003ffULL, 0xffffffffffffffffULL, 0x0000000000000fffULL,
+    0xffffffffffffffffULL, 0x0000000000000fffULL, 0xffffffffffffffffULL, 0x0000000000001fffULL,
+    0xffffffffffffffffULL, 0x0000000000001fffULL, 0xffffffffffffffffULL, 0x0000000000003fffULL,
+    0xffffffffffffffffULL, 0x0000000000003fffULL, 0xffffffffffffffffULL, 0x0000000000007fffULL,
+    0xffffffffffffffffULL, 0x0000000000007fffULL, 0xffffffffffffffffULL, 0x000000000000ffffULL,
+    0xfffffffffffffffeULL, 0x000000000000ffffULL, 0xfffffffffffffffcULL, 0x000000000000ffffULL,
+    0xfffffffffffffffcULL, 0x000000000001ffffULL, 0xfffffffffffffffcULL, 0x000000000003ffffULL,
+    0xfffffffffffffffcULL, 0x000000000001ffffULL, 0xfffffffffffffffcULL, 0x000000000007ffffULL,
+    0xfffffffffffffff0ULL, 0x000000000007ffffULL, 0xfffffffffffffff0ULL, 0x000000000007ffffULL,
+    0xfffffffffffffff0ULL, 0x000000000007ffffULL, 0xfffffffffffffff0ULL, 0x000000000007ffffULL,
+    0xfffffffffffffff0ULL, 0x000000000007ffffULL, 0xfffffffffffffff0ULL, 0x000000000007ffffULL,
+    0xfffffffffffffff0ULL, 0x000000000007ffffULL, 0xfffffffffffffff0ULL, 0x000000000007ffffULL,
+    0xfffffffffffffff0ULL, 0x000000000001ffffULL, 0xffffffffffffffe0ULL, 0x000000000001ffffULL,
+    0xffffffffffffffe0ULL, 0x000000000001ffffULL, 0xffffffffffffff00ULL, 0x000000000001ffffULL,
+    0xffffffffffffff00ULL, 0x000000000001ffffULL, 0xffffffffffffff00ULL, 0x000000000001ffffULL,
+    0xffffffffffffff00ULL, 0x000000000001ffffULL, 0xffffffffffffff00ULL, 0x000000000001ffffULL,
+    0xffffffffffffff00ULL, 0x000000000003ffffULL, 0xffffffffffffff00ULL, 0x000000000007ffffULL,
+    0xffffffffffffff00ULL, 0x000000000007ffffULL, 0xfffffffffffff800ULL, 0x000000000007ffffULL,
+    0xfffffffffffffc00ULL, 0x000000000007ffffULL, 0xfffffffffffffe00ULL, 0x000000000007ffffULL,
+    0xfffffffffffffe00ULL, 0x000000000007ffffULL, 0xfffffffffffffc00ULL, 0x000000000007ffffULL,
+    0xfffffffffffffc00ULL, 0x00000000001fffffULL, 0xfffffffffffffe00ULL, 0x00000000000fffffULL,
+    0xfffffffffffffe00ULL, 0x00000000000fffffULL, 0xfffffffffffffc00ULL, 0x00000000000fffffULL,
+    0xfffffffffffffc00ULL, 0x00000000000fffffULL, 0xfffffffffffffc00ULL, 0x00000000000fffffULL,
+    0xfffffffffffffe00ULL, 0x00000000000fffffULL, 0xfffffffffffff800ULL, 0x00000000000fffffULL,
+    0xfffffffffffff800ULL, 0x00000000000fffffULL, 0xfffffffffffff800ULL, 0x00000000000fffffULL,
+    0xfffffffffffff000ULL, 0x00000000000fffffULL, 0xffffffffffffe000ULL, 0x000000000003ffffULL,
+    0xfffffffffe000000ULL, 0x000000000003ffffULL, 0xfffdfffffe000000ULL, 0x000000000001ffffULL,
+    0xfff8fffffe000000ULL, 0x000000000000ffffULL, 0xfff8fffffe000000ULL, 0x0000000000003fffULL,
+    0xfff8fffffe000000ULL, 0x0000000000003fffULL, 0xfff8ffffff800000ULL, 0x00000000000007ffULL,
+    0xfff8ffffff800000ULL, 0x00000000000003ffULL, 0xfffc7fffff800000ULL, 0x00000000000003ffULL,
+    0xfffc3fffff800000ULL, 0x00000000000003ffULL, 0xfffc3fffff800000ULL, 0x00000000000001ffULL,
+    0xfffc3fffff800000ULL, 0x00000000000001ffULL, 0xfffc3fffffe00000ULL, 0x00000000000001ffULL,
+    0xfffc7fffffe00000ULL, 0x00000000000001ffULL, 0xfffc1fffffe00000ULL, 0x00000000000001ffULL,
+    0xfffc1fffffe00000ULL, 0x00000000000001ffULL, 0xfffc1fffffe00000ULL, 0x00000000000001ffULL,
+    0xfffc1ffffff80000ULL, 0x00000000000001ffULL, 0xfffc1ffffff00000ULL, 0x00000000000001ffULL,
+    0xfffc0ffffff00000ULL, 0x00000000000001ffULL, 0xfffc0ffffff00000ULL, 0x00000000000003ffULL,
+    0xfffc0ffffff00000ULL, 0x00000000000003ffULL, 0xfffc0ffffff80000ULL, 0x00000000000003ffULL,
+    0xfffc03fffffc0000ULL, 0x00000000000003ffULL, 0xfffe03fffffc0000ULL, 0x00000000000003ffULL,
+    0xfffe03fffffc0000ULL, 0x00000000000003ffULL, 0xfffe03fffffc0000ULL, 0x00000000000003ffULL,
+    0xfffe03ffffff0000ULL, 0x00000000000003ffULL, 0xfffe00ffffff0000ULL, 0x00000000000003ffULL,
+    0xfffe00ffffff0000ULL, 0x00000000000000ffULL, 0xfffe00ffffff8000ULL, 0x00000000000000ffULL,
+    0xfffe00ffffffc000ULL, 0x00000000000001ffULL, 0xffff003fffffc000ULL, 0x000000000000007fULL,
+    0xffff803fffffc000ULL, 0x000000000000007fULL, 0xffff003fffffc000ULL, 0x000000000000007fULL,
+    0xffff803fffffc000ULL, 0x000000000000007fULL, 0xffff803fffffc000ULL, 0x000000000000007fULL,
+    0xffff800fffffc000ULL, 0x000000000000003fULL, 0xffff801ffffff000ULL, 0x000000000000003fULL,
+    0xffff801fffffe000ULL, 0x000000000000003fULL, 0xffff801fffffe000ULL, 0x000000000000003fULL,
+    0xffff800fffffe000ULL, 0x000000000000003fULL, 0xffff800fffffe000ULL, 0x000000000000003fULL,
+    0xffff800ffffff000ULL, 0x000000000000003fULL, 0xffff8007fffff800ULL, 0x000000000000003fULL,
+    0xffff8007fffff800ULL, 0x000000000000003fULL, 0xffff8007fffff800ULL, 0x000000000000003fULL,
+    0xffff8007fffff800ULL, 0x000000000000003fULL, 0xffff0007fffff800ULL, 0x000000000000003fULL,
+    0xffff0007fffff800ULL, 0x000000000000003fULL, 0xffff0007fffff800ULL, 0x000000000000003fULL,
+    0xffff0001fffffc00ULL, 0x000000000000003fULL, 0xffff0001fffffc00ULL, 0x000000000000003fULL,
+    0xffff0001fffffc00ULL, 0x000000000000003fULL, 0xffff0001fffffc00ULL, 0x000000000000003fULL,
+    0xffff0001fffffc00ULL, 0x000000000000003fULL, 0xffff0001fffffc00ULL, 0x000000000000003fULL,
+    0xffff0001fffffc00ULL, 0x000000000000007fULL, 0xffff8001fffffe00ULL, 0x00000000000001ffULL,
+    0xffffc000ffffff80ULL, 0x00000000000001ffULL, 0xffffc000ffffff80ULL, 0x00000000000001ffULL,
+    0xffffc001ffffff80ULL, 0x00000000000001ffULL, 0xffffc001ffffff00ULL, 0x00000000000001ffULL,
+    0xffff8003ffffff00ULL, 0x00000000000001ffULL, 0xffff0003ffffffc0ULL, 0x00000000000001ffULL,
+    0xffff8003ffffffe0ULL, 0x00000000000003ffULL, 0xffffc003ffffffc0ULL, 0x0000000000000fffULL,
+    0xffffc003ffffffc0ULL, 0x0000000000000fffULL, 0xffffc003ffffffc0ULL, 0x0000000000000fffULL,
+    0xffffc000ffffffe0ULL, 0x0000000000000fffULL, 0xffffc000ffffffe0ULL, 0x0000000000001fffULL,
+    0xffffc000ffffff80ULL, 0x0000000000001fffULL, 0xffff8001ffffff80ULL, 0x0000000000007fffULL,
+    0xffff8003ffffff80ULL, 0x0000000000007fffULL, 0xffff8003ffffffc0ULL, 0x000000000000ffffULL,
+    0xffff8007ffffffc0ULL, 0x000000000001ffffULL, 0xffff8007ffffffc0ULL, 0x000000000007ffffULL,
+    0xffff803fffffffc0ULL, 0x000000000fffffffULL, 0xffff803fffffffc0ULL, 0x000000000fffffffULL,
+    0xffff80ffffffffc0ULL, 0x00000000ffffffffULL, 0xffff80ffffffffc0ULL, 0x00000001ffffffffULL,
+    0xffff80ffffffffc0ULL, 0x00000001ffffffffULL, 0xffff83ffffffffc0ULL, 0x00000003ffffffffULL,
+    0xffff81ffffffffc0ULL, 0x00000007ffffffffULL, 0xffff8fffffffffc0ULL, 0x00000017ffffffffULL,
+    0xffff8fffffffffc0ULL, 0x0000001fffffffffULL, 0xffff8fffffffffc0ULL, 0x0000001fffffffffULL,
+    0xffff8fffffffffc0ULL, 0x00000017ffffffffULL, 0xffff8fffffffffc0ULL, 0x00000017ffffffffULL,
+    0xffff8fffffffffc0ULL, 0x00000017ffffffffULL, 0xffff8fffffffffc0ULL, 0x00000017ffffffffULL,
+    0xffff8fffffffffc0ULL, 0x0000001fffffffffULL, 0xffff8fffffffff00ULL, 0x0000001fffffffffULL,
+    0xffff8fffffffff00ULL, 0x0000000fff7fffffULL, 0x000001fffffffc00ULL, 0x00000003fef88000ULL,
+};
+
+// img/standing.png mirrored, 101x260
+static const uint64_t standing_left_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00fffc0000000000ULL, 0x0000000000000000ULL,
+    0x007ffc0000000000ULL, 0x0000000000000000ULL, 0x1fffffc000000000ULL, 0x0000000000000000ULL,
+    0x1ffffff000000000ULL, 0x0000000000000000ULL, 0xffffffff80000000ULL, 0x0000000000000001ULL,
+    0xffffffffe0000000ULL, 0x0000000000000001ULL, 0xfffffffff8000000ULL, 0x000000000000000fULL,
+    0xfffffffffc000000ULL, 0x000000000000001fULL, 0xfffffffffc000000ULL, 0x000000000000001fULL,
+    0xffffffffff000000ULL, 0x000000000000007fULL, 0xffffffffffc00000ULL, 0x000000000000007fULL,
+    0xffffffffffc00000ULL, 0x00000000000001ffULL, 0xffffffffffe00000ULL, 0x00000000000001ffULL,
+    0xffffffffffe00000ULL, 0x00000000000007ffULL, 0xfffffffffff80000ULL, 0x00000000000007ffULL,
+    0xfffffffffff80000ULL, 0x0000000000000fffULL, 0xfffffffffffc0000ULL, 0x00000000000007ffULL,
+    0xfffffffffffc0000ULL, 0x00000000000007ffULL, 0xffffffffffff0000ULL, 0x0000000000001fffULL,
+    0xffffffffffff0000ULL, 0x0000000000001fffULL, 0xffffffffffff8000ULL, 0x0000000000001fffULL,
+    0xffffffffffff8000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL,
+    0xffffffffffffc000ULL, 0x0000000000001fffULL, 0xffffffffffffc000ULL, 0x0000000000003fffULL,
+    0xffffffffffffc000ULL, 0x0000000000000fffULL, 0xffffffffffffc000ULL, 0x0000000000000fffULL,
+    0xfffffffffff3c000ULL, 0x0000000000000fffULL, 0xffffffffffc18000ULL, 0x0000000000000fffULL,
+    0xffffffffffc10000ULL, 0x00000000000003ffULL, 0xffffffffffc00000ULL, 0x00000000000003ffULL,
+    0xffffffffff800000ULL, 0x00000000000003ffULL, 0xffffffffff800000ULL, 0x00000000000003ffULL,
+    0xffffffffff800000ULL, 0x00000000000001ffULL, 0xffffffffff800000ULL, 0x00000000000001ffULL,
+    0xffffffffff800000ULL, 0x00000000000000ffULL, 0xffffffffff800000ULL, 0x000000000000007fULL,
+    0xffffffffff800000ULL, 0x000000000000007fULL, 0xffffffffff800000ULL, 0x000000000000000fULL,
+    0xffffffffff800000ULL, 0x000000000000000fULL, 0xffffffffff800000ULL, 0x0000000000000001ULL,
+    0x07ffffffff800000ULL, 0x0000000000000000ULL, 0x07ffffffff800000ULL, 0x0000000000000000ULL,
+    0x07ffffffff800000ULL, 0x0000000000000000ULL, 0x07fffffffe000000ULL, 0x0000000000000000ULL,
+    0x07fffffffe000000ULL, 0x0000000000001ff8ULL, 0x0ffffffffe000000ULL, 0x000000000000bffcULL,
+    0xfffffffffc000000ULL, 0x000000000000ffffULL, 0xfffffffffc000000ULL, 0x000000000001ffffULL,
+    0xfffffffff8000000ULL, 0x00000000000bffffULL, 0xfffffffff0000000ULL, 0x00000000000fffffULL,
+    0xffffffffe0000000ULL, 0x00000000000fffffULL, 0xffffffffe0000000ULL, 0x00000000000fffffULL,
+    0xffffffff80000000ULL, 0x00000000003fffffULL, 0xffffff8000000000ULL, 0x00000000003fffffULL,
+    0xffffff8000000000ULL, 0x00000000003fffffULL, 0xfffffff000000000ULL, 0x00000000003fffffULL,
+    0xfffffff400000000ULL, 0x00000000003fffffULL, 0xfffffffc00000000ULL, 0x00000000003fffffULL,
+    0xfffffffe00000000ULL, 0x00000000003fffffULL, 0xfffffffe00000000ULL, 0x00000000007fffffULL,
+    0xffffffff00000000ULL, 0x00000000007fffffULL, 0xffffffff80000000ULL, 0x00000000007fffffULL,
+    0xffffffffc0000000ULL, 0x00000000007fffffULL, 0xffffffffc0000000ULL, 0x00000000007fffffULL,
+    0xffffffffc0000000ULL, 0x00000000007fffffULL, 0xffffffffc0000000ULL, 0x00000000003fffffULL,
+    0xffffffffc0000000ULL, 0x00000000003fffffULL, 0xffffffffc0000000ULL, 0x00000000007fffffULL,
+    0xffffffffc0000000ULL, 0x00000000007fffffULL, 0xffffffffc0000000ULL, 0x00000000007fffffULL,
+    0xfffffffff8000000ULL, 0x00000000007fffffULL, 0xfffffffff0000000ULL, 0x00000000007fffffULL,
+    0xfffffffff0000000ULL, 0x0000000001ffffffULL, 0xfffffffff0000000ULL, 0x0000000000ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000000ffffffULL, 0xfffffffff0000000ULL, 0x0000000001ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000003ffffffULL, 0xfffffffff0000000ULL, 0x0000000003ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000003ffffffULL, 0xfffffffff0000000ULL, 0x0000000007ffffffULL,
+    0xfffffffff0000000ULL, 0x000000000fffffffULL, 0xfffffffff0000000ULL, 0x000000000fffffffULL,
+    0xfffffffff0000000ULL, 0x000000000fffffffULL, 0xfffffffff0000000ULL, 0x000000000fffffffULL,
+    0xfffffffff0000000ULL, 0x000000001fffffffULL, 0xfffffffff0000000ULL, 0x000000003fffffffULL,
+    0xfffffffff8000000ULL, 0x000000003fffffffULL, 0xfffffffff8000000ULL, 0x000000003fffffffULL,
+    0xfffffffff8000000ULL, 0x00000000ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000007ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000007ffffffffULL, 0xfffffffff8000000ULL, 0x00000007ffffffffULL,
+    0xfffffffff8000000ULL, 0x0000001fffffffffULL, 0xfffffffff8000000ULL, 0x0000001fffffffffULL,
+    0xfffffffff8000000ULL, 0x0000001fffffffffULL, 0xfffffffff8000000ULL, 0x0000001fffffffffULL,
+    0xfffffffff8000000ULL, 0x0000001fffffffffULL, 0xfffffffffe000000ULL, 0x0000001fffffffffULL,
+    0xfffffffffe000000ULL, 0x0000001fffffffffULL, 0xffffffffff000000ULL, 0x0000001fffffffffULL,
+    0xffffffffff000000ULL, 0x0000001fffffffffULL, 0xffffffffff800000ULL, 0x0000001fffffffffULL,
+    0xffffffffff800000ULL, 0x0000001fffffffffULL, 0xffffffffffc00000ULL, 0x0000001fffffffffULL,
+    0xffffffffffc00000ULL, 0x0000001fffffffffULL, 0xffffffffffe00000ULL, 0x0000001fffffffffULL,
+    0xffffffffffe00000ULL, 0x0000000fffffffffULL, 0xffffffffffe00000ULL, 0x00000007ffffffffULL,
+    0xfffffffffff00000ULL, 0x00000007ffffffffULL, 0xfffffffffff80000ULL, 0x00000007ffffffffULL,
+    0xfffffffffff00000ULL, 0x00000007ffffffffULL, 0xfffffffffffc0000ULL, 0x00000007ffffffffULL,
+    0xfffffffffffc0000ULL, 0x00000001ffffffffULL, 0xfffffffffffc0000ULL, 0x00000001ffffffffULL,
+    0xfffffffffffc0000ULL, 0x00000001ffffffffULL, 0xfffffffffffc0000ULL, 0x00000001ffffffffULL,
+    0xfffffffffffc0000ULL, 0x00000001ffffffffULL, 0xfffffffffffc0000ULL, 0x00000001ffffffffULL,
+    0xfffffffffffc0000ULL, 0x00000001ffffffffULL, 0xfffffffffffc0000ULL, 0x00000001ffffffffULL,
+    0xfffffffffff00000ULL, 0x00000001ffffffffULL, 0xfffffffffff00000ULL, 0x00000000ffffffffULL,
+    0xfffffffffff00000ULL, 0x00000000ffffffffULL, 0xfffffffffff00000ULL, 0x000000001fffffffULL,
+    0xfffffffffff00000ULL, 0x000000001fffffffULL, 0xfffffffffff00000ULL, 0x000000001fffffffULL,
+    0xfffffffffff00000ULL, 0x000000001fffffffULL, 0xfffffffffff00000ULL, 0x000000001fffffffULL,
+    0xfffffffffff80000ULL, 0x000000001fffffffULL, 0xfffffffffffc0000ULL, 0x000000001fffffffULL,
+    0xfffffffffffc0000ULL, 0x000000001fffffffULL, 0xfffffffffffc0000ULL, 0x0000000003ffffffULL,
+    0xfffffffffffc0000ULL, 0x0000000007ffffffULL, 0xfffffffffffc0000ULL, 0x000000000fffffffULL,
+    0xfffffffffffc0000ULL, 0x000000000fffffffULL, 0xfffffffffffc0000ULL, 0x0000000007ffffffULL,
+    0xffffffffffff0000ULL, 0x0000000007ffffffULL, 0xfffffffffffe0000ULL, 0x000000000fffffffULL,
+    0xfffffffffffe0000ULL, 0x000000000fffffffULL, 0xfffffffffffe0000ULL, 0x0000000007ffffffULL,
+    0xfffffffffffe0000ULL, 0x0000000007ffffffULL, 0xfffffffffffe0000ULL, 0x0000000007ffffffULL,
+    0xfffffffffffe0000ULL, 0x000000000fffffffULL, 0xfffffffffffe0000ULL, 0x0000000003ffffffULL,
+    0xfffffffffffe0000ULL, 0x0000000003ffffffULL, 0xfffffffffffe0000ULL, 0x0000000003ffffffULL,
+    0xfffffffffffe0000ULL, 0x0000000001ffffffULL, 0xfffffffffff80000ULL, 0x0000000000ffffffULL,
+    0xfffffffffff80000ULL, 0x0000000000000fffULL, 0xfff7fffffff00000ULL, 0x0000000000000fffULL,
+    0xffe3ffffffe00000ULL, 0x0000000000000fffULL, 0xffe3ffffff800000ULL, 0x0000000000000fffULL,
+    0xffe3ffffff800000ULL, 0x0000000000000fffULL, 0xffe3fffffc000000ULL, 0x0000000000003fffULL,
+    0xffe3fffff8000000ULL, 0x0000000000003fffULL, 0xffc7fffff8000000ULL, 0x0000000000003fffULL,
+    0xff87fffff8000000ULL, 0x0000000000003fffULL, 0xff87fffff0000000ULL, 0x0000000000003fffULL,
+    0xff87fffff0000000ULL, 0x0000000000003fffULL, 0xff87fffff0000000ULL, 0x000000000000ffffULL,
+    0xffc7fffff0000000ULL, 0x000000000000ffffULL, 0xff07fffff0000000ULL, 0x000000000000ffffULL,
+    0xff07fffff0000000ULL, 0x000000000000ffffULL, 0xff07fffff0000000ULL, 0x000000000000ffffULL,
+    0xff07fffff0000000ULL, 0x000000000003ffffULL, 0xff07fffff0000000ULL, 0x000000000001ffffULL,
+    0xfe07fffff0000000ULL, 0x000000000001ffffULL, 0xfe07fffff8000000ULL, 0x000000000001ffffULL,
+    0xfe07fffff8000000ULL, 0x000000000001ffffULL, 0xfe07fffff8000000ULL, 0x000000000003ffffULL,
+    0xf807fffff8000000ULL, 0x000000000007ffffULL, 0xf80ffffff8000000ULL, 0x000000000007ffffULL,
+    0xf80ffffff8000000ULL, 0x000000000007ffffULL, 0xf80ffffff8000000ULL, 0x000000000007ffffULL,
+    0xf80ffffff8000000ULL, 0x00000000001fffffULL, 0xe00ffffff8000000ULL, 0x00000000001fffffULL,
+    0xe00fffffe0000000ULL, 0x00000000001fffffULL, 0xe00fffffe0000000ULL, 0x00000000003fffffULL,
+    0xe00ffffff0000000ULL, 0x00000000007fffffULL, 0x801fffffc0000000ULL, 0x00000000007fffffULL,
+    0x803fffffc0000000ULL, 0x00000000007fffffULL, 0x801fffffc0000000ULL, 0x00000000007fffffULL,
+    0x803fffffc0000000ULL, 0x00000000007fffffULL, 0x803fffffc0000000ULL, 0x00000000007fffffULL,
+    0x003fffff80000000ULL, 0x00000000007ffffeULL, 0x003fffff80000000ULL, 0x0000000001ffffffULL,
+    0x003fffff80000000ULL, 0x0000000000ffffffULL, 0x003fffff80000000ULL, 0x0000000000ffffffULL,
+    0x003fffff80000000ULL, 0x0000000000fffffeULL, 0x003fffff80000000ULL, 0x0000000000fffffeULL,
+    0x003fffff80000000ULL, 0x0000000001fffffeULL, 0x003fffff80000000ULL, 0x0000000003fffffcULL,
+    0x003fffff80000000ULL, 0x0000000003fffffcULL, 0x003fffff80000000ULL, 0x0000000003fffffcULL,
+    0x003fffff80000000ULL, 0x0000000003fffffcULL, 0x001fffff80000000ULL, 0x0000000003fffffcULL,
+    0x001fffff80000000ULL, 0x0000000003fffffcULL, 0x001fffff80000000ULL, 0x0000000003fffffcULL,
+    0x001fffff80000000ULL, 0x0000000007fffff0ULL, 0x001fffff80000000ULL, 0x0000000007fffff0ULL,
+    0x001fffff80000000ULL, 0x0000000007fffff0ULL, 0x001fffff80000000ULL, 0x0000000007fffff0ULL,
+    0x001fffff80000000ULL, 0x0000000007fffff0ULL, 0x001fffff80000000ULL, 0x0000000007fffff0ULL,
+    0x001fffffc0000000ULL, 0x0000000007fffff0ULL, 0x003ffffff0000000ULL, 0x000000000ffffff0ULL,
+    0x007ffffff0000000ULL, 0x000000003fffffe0ULL, 0x007ffffff0000000ULL, 0x000000003fffffe0ULL,
+    0x007ffffff0000000ULL, 0x000000003ffffff0ULL, 0x007ffffff0000000ULL, 0x000000001ffffff0ULL,
+    0x003ffffff0000000ULL, 0x000000001ffffff8ULL, 0x001ffffff0000000ULL, 0x000000007ffffff8ULL,
+    0x003ffffff8000000ULL, 0x00000000fffffff8ULL, 0x007ffffffe000000ULL, 0x000000007ffffff8ULL,
+    0x007ffffffe000000ULL, 0x000000007ffffff8ULL, 0x007ffffffe000000ULL, 0x000000007ffffff8ULL,
+    0x007ffffffe000000ULL, 0x00000000ffffffe0ULL, 0x007fffffff000000ULL, 0x00000000ffffffe0ULL,
+    0x007fffffff000000ULL, 0x000000003fffffe0ULL, 0x003fffffffc00000ULL, 0x000000003ffffff0ULL,
+    0x003fffffffc00000ULL, 0x000000003ffffff8ULL, 0x003fffffffe00000ULL, 0x000000007ffffff8ULL,
+    0x003ffffffff00000ULL, 0x000000007ffffffcULL, 0x003ffffffffc0000ULL, 0x000000007ffffffcULL,
+    0x803ffffffffffe00ULL, 0x000000007fffffffULL, 0x803ffffffffffe00ULL, 0x000000007fffffffULL,
+    0xe03fffffffffffe0ULL, 0x000000007fffffffULL, 0xe03ffffffffffff0ULL, 0x000000007fffffffULL,
+    0xe03ffffffffffff0ULL, 0x000000007fffffffULL, 0xf83ffffffffffff8ULL, 0x000000007fffffffULL,
+    0xf03ffffffffffffcULL, 0x000000007fffffffULL, 0xfe3ffffffffffffdULL, 0x000000007fffffffULL,
+    0xfe3fffffffffffffULL, 0x000000007fffffffULL, 0xfe3fffffffffffffULL, 0x000000007fffffffULL,
+    0xfe3ffffffffffffdULL, 0x000000007fffffffULL, 0xfe3ffffffffffffdULL, 0x000000007fffffffULL,
+    0xfe3ffffffffffffdULL, 0x000000007fffffffULL, 0xfe3ffffffffffffdULL, 0x000000007fffffffULL,
+    0xfe3fffffffffffffULL, 0x000000007fffffffULL, 0xfe3fffffffffffffULL, 0x000000001fffffffULL,
+    0xfe3fffffffffdffeULL, 0x000000001fffffffULL, 0xf00000000023eff8ULL, 0x0000000007ffffffULL,
+};
+
+// img/walk1.png, 101x260
+static const uint64_t walk1_right_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff0000000000000ULL, 0x0000000000000001ULL,
+    0xfff0000000000000ULL, 0x0000000000000001ULL, 0xffff800000000000ULL, 0x000000000000003dULL,
+    0xffff800000000000ULL, 0x00000000000001ffULL, 0xffffdc0000000000ULL, 0x0000000000001fffULL,
+    0xfffffc0000000000ULL, 0x0000000000005fffULL, 0xfffff82000000000ULL, 0x0000000000007fffULL,
+    0xfffffdc000000000ULL, 0x000000000001ffffULL, 0xffffffc000000000ULL, 0x000000000003ffffULL,
+    0xffffffc000000000ULL, 0x000000000003ffffULL, 0xfffffff000000000ULL, 0x00000000000fffffULL,
+    0xfffffff000000000ULL, 0x00000000003fffffULL, 0xfffffffa00000000ULL, 0x00000000003fffffULL,
+    0xfffffffa00000000ULL, 0x00000000003fffffULL, 0xffffffff00000000ULL, 0x0000000000ffffffULL,
+    0xffffffff00000000ULL, 0x0000000001ffffffULL, 0xffffffff00000000ULL, 0x0000000000ffffffULL,
+    0xffffffff00000000ULL, 0x0000000001ffffffULL, 0xffffffffc0000000ULL, 0x0000000007ffffffULL,
+    0xffffffffc0000000ULL, 0x0000000007ffffffULL, 0xffffffffc0000000ULL, 0x000000000fffffffULL,
+    0xffffffffc0000000ULL, 0x0000000007ffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001e7fffffULL,
+    0xfffffffe00000000ULL, 0x000000001e3fffffULL, 0xffffffff00000000ULL, 0x00000000027fffffULL,
+    0xffffffff00000000ULL, 0x000000000e5fffffULL, 0xffffffff00000000ULL, 0x000000000e0fffffULL,
+    0xfffffffd00000000ULL, 0x00000000001fffffULL, 0xfffffff800000000ULL, 0x00000000001fffffULL,
+    0xfffffffc00000000ULL, 0x000000000003ffffULL, 0xfffffffc00000000ULL, 0x000000000007ffffULL,
+    0xfffffffc00000000ULL, 0x000000000007ffffULL, 0xfffffffc00000000ULL, 0x000000000007ffffULL,
+    0xfffffff800000000ULL, 0x000000000007ffffULL, 0xfffffff000000000ULL, 0x000000000007ffffULL,
+    0xffffffd000000000ULL, 0x000000000007ffffULL, 0xffffffc000000000ULL, 0x000000000007ffffULL,
+    0xfffffd8000000000ULL, 0x000000000007ffffULL, 0xffffc40000000000ULL, 0x000000000007ffffULL,
+    0xffffd00000000000ULL, 0x000000000007ffffULL, 0xffff800000000000ULL, 0x000000000007ffffULL,
+    0xffffc00000000000ULL, 0x000000000007ffffULL, 0xffffc00000000000ULL, 0x000000000001ffffULL,
+    0xffffc03ffc000000ULL, 0x000000000003ffffULL, 0xffffe03fff000000ULL, 0x000000000003ffffULL,
+    0xfffffffffe000000ULL, 0x0000000000007fffULL, 0xffffffffff000000ULL, 0x000000000000ffffULL,
+    0xffffffffffb00000ULL, 0x0000000000003fffULL, 0xfffffffffff00000ULL, 0x0000000000003fffULL,
+    0xfffffffffff00000ULL, 0x0000000000000fffULL, 0xffffffffffe00000ULL, 0x0000000000000fffULL,
+    0xfffffffffff40000ULL, 0x000000000000077fULL, 0xfffffffffffc0000ULL, 0x0000000000000001ULL,
+    0xfffffffffffc0000ULL, 0x0000000000000001ULL, 0xfffffffffff80000ULL, 0x0000000000000001ULL,
+    0xfffffffffff80000ULL, 0x000000000000000fULL, 0xfffffffffff80000ULL, 0x000000000000000fULL,
+    0xfffffffffffc0000ULL, 0x000000000000003fULL, 0xffffffffffff0000ULL, 0x000000000000003fULL,
+    0xffffffffffff0000ULL, 0x000000000000001fULL, 0xffffffffffff0000ULL, 0x00000000000000bfULL,
+    0xffffffffffff0000ULL, 0x00000000000000ffULL, 0xffffffffffff0000ULL, 0x00000000000000ffULL,
+    0xfffffffffffe0000ULL, 0x00000000000000ffULL, 0xfffffffffffe0000ULL, 0x00000000000000ffULL,
+    0xfffffffffffe0000ULL, 0x00000000000000ffULL, 0xffffffffffff0000ULL, 0x00000000000000ffULL,
+    0xffffffffffff0000ULL, 0x00000000000000ffULL, 0xffffffffffff8000ULL, 0x00000000000000ffULL,
+    0xffffffffffff8000ULL, 0x00000000000007ffULL, 0xffffffffffffc000ULL, 0x00000000000001ffULL,
+    0xffffffffffffc000ULL, 0x00000000000001ffULL, 0xffffffffffffc000ULL, 0x00000000000001ffULL,
+    0xffffffffffffc000ULL, 0x00000000000001ffULL, 0xffffffffffffc000ULL, 0x00000000000001ffULL,
+    0xfffffffffffff000ULL, 0x00000000000001ffULL, 0xffffffffffffe000ULL, 0x00000000000001ffULL,
+    0xfffffffffffff000ULL, 0x00000000000001ffULL, 0xfffffffffffff800ULL, 0x00000000000001ffULL,
+    0xfffffffffffff800ULL, 0x00000000000001ffULL, 0xfffffffffffffe00ULL, 0x00000000000001ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000001ffULL, 0xfffffffffffffc00ULL, 0x00000000000003ffULL,
+    0xffffffffffffff00ULL, 0x00000000000003ffULL, 0xffffffffffffff00ULL, 0x00000000000003ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000001ffULL, 0xffffffffffffffc0ULL, 0x00000000000001ffULL,
+    0xffffffffffffffe0ULL, 0x00000000000001ffULL, 0xffffffffffffffe0ULL, 0x00000000000001ffULL,
+    0xfffffffffffffff0ULL, 0x00000000000001ffULL, 0xfffffffffffffff0ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff0ULL, 0x00000000000003ffULL, 0xfffffffffffffffcULL, 0x00000000000002ffULL,
+    0xfffffffffffffffcULL, 0x00000000000000ffULL, 0xfffffffffffffff8ULL, 0x00000000000000ffULL,
+    0xfffffffffffffffcULL, 0x00000000000000ffULL, 0xffffffffffffffffULL, 0x00000000000000ffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xffffffffffffffffULL, 0x00000000000000ffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xffffffffffffffffULL, 0x00000000000000ffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xffffffffffffffffULL, 0x00000000000000ffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xffffffffffffffffULL, 0x00000000000000ffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xffffffffffffffffULL, 0x00000000000000ffULL,
+    0xffffffffffffffffULL, 0x00000000000000ffULL, 0xfffffffffffffffeULL, 0x00000000000000ffULL,
+    0xfffffffffffffffcULL, 0x00000000000000ffULL, 0xfffffffffffffffeULL, 0x00000000000000ffULL,
+    0xfffffffffffffffeULL, 0x00000000000000ffULL, 0xfffffffffffffffeULL, 0x00000000000000ffULL,
+    0xfffffffffffffffeULL, 0x00000000000001ffULL, 0xfffffffffffffff4ULL, 0x00000000000001ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000001ffULL, 0xfffffffffffffff8ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000003ffULL, 0xfffffffffffffff8ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000003ffULL, 0xfffffffffffffff8ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000003ffULL, 0xfffffffffffffff8ULL, 0x00000000000003ffULL,
+    0xfffffffffffffff8ULL, 0x00000000000003ffULL, 0xffffffffffffffe0ULL, 0x00000000000003ffULL,
+    0xffffffffffffffe0ULL, 0x00000000000003ffULL, 0xffffffffffffffc0ULL, 0x00000000000003ffULL,
+    0xffffffffffffff00ULL, 0x00000000000003ffULL, 0xffffffffffffff80ULL, 0x00000000000003ffULL,
+    0xffffffffffffff80ULL, 0x00000000000003ffULL, 0xffffffffffffff80ULL, 0x00000000000003ffULL,
+    0xffffffffffffff80ULL, 0x00000000000003ffULL, 0xffffffffffffff80ULL, 0x00000000000003ffULL,
+    0xfffffffffffffc00ULL, 0x00000000000003ffULL, 0xfffffffffffffa00ULL, 0x00000000000003ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000003ffULL, 0xfffffffffffffe00ULL, 0x00000000000003ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000003ffULL, 0xfffffffffffffe00ULL, 0x00000000000003ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000007ffULL, 0xfffffffffffffe00ULL, 0x00000000000007ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000007ffULL, 0xfffffffffffffe00ULL, 0x00000000000007ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000007ffULL, 0xfffffffffffffe00ULL, 0x00000000000007ffULL,
+    0xfffffffffffffe00ULL, 0x00000000000007ffULL, 0xfffffffffffffe00ULL, 0x00000000000007ffULL,
+    0xfffffffffffff800ULL, 0x00000000000007ffULL, 0xfffffffffffffc00ULL, 0x00000000000007ffULL,
+    0xffffffffffffe000ULL, 0x00000000000000ffULL, 0xffffffffefafa000ULL, 0x00000000000001ffULL,
+    0xffffffff0fcf0000ULL, 0x00000000000000ffULL, 0xffffffff00000000ULL, 0x00000000000000ffULL,
+    0xfffffffe00000000ULL, 0x00000000000000ffULL, 0xfffffffe00000000ULL, 0x00000000000000ffULL,
+    0xfffffffe00000000ULL, 0x00000000000000ffULL, 0xfffffffc00000000ULL, 0x000000000000007fULL,
+    0xfffffffc00000000ULL, 0x000000000000007fULL, 0xfffffffc00000000ULL, 0x000000000000007fULL,
+    0xfffffffc00000000ULL, 0x000000000000007fULL, 0xfffffff800000000ULL, 0x000000000000007fULL,
+    0xffffffe000000000ULL, 0x000000000000007fULL, 0xffffffe000000000ULL, 0x000000000000007fULL,
+    0xffffffe000000000ULL, 0x000000000000007fULL, 0xfffffff000000000ULL, 0x000000000000007fULL,
+    0xffffffe000000000ULL, 0x000000000000003fULL, 0xffffffe000000000ULL, 0x000000000000007fULL,
+    0xffffffe000000000ULL, 0x00000000000001ffULL, 0xffffffe000000000ULL, 0x00000000000001ffULL,
+    0xffffffc000000000ULL, 0x00000000000001ffULL, 0xffffffc000000000ULL, 0x00000000000003ffULL,
+    0xffffff8000000000ULL, 0x00000000000003ffULL, 0xffffff0000000000ULL, 0x00000000000003ffULL,
+    0xffffff0000000000ULL, 0x00000000000003ffULL, 0xffffff0000000000ULL, 0x00000000000003ffULL,
+    0xffffffe000000000ULL, 0x00000000000003ffULL, 0xffffffe000000000ULL, 0x00000000000003ffULL,
+    0xfffffffc00000000ULL, 0x00000000000003ffULL, 0xfffffffd00000000ULL, 0x00000000000003ffULL,
+    0xffffffff00000000ULL, 0x00000000000001ffULL, 0xffffffff80000000ULL, 0x000000000000007fULL,
+    0xfffffffff8000000ULL, 0x000000000000007fULL, 0xfffffffff0000000ULL, 0x00000000000000ffULL,
+    0xfffffffffc000000ULL, 0x000000000000007fULL, 0xfffffffffd800000ULL, 0x000000000000007fULL,
+    0xffffffffffb00000ULL, 0x000000000000007fULL, 0xfffffffffff00000ULL, 0x000000000000007fULL,
+    0xfffffffffffc0000ULL, 0x000000000000003fULL, 0xfffffffffffc0000ULL, 0x000000000000001fULL,
+    0xffffffffffff0000ULL, 0x000000000000003fULL, 0xffffffffffff6000ULL, 0x000000000000003fULL,
+    0xffffffffffffe000ULL, 0x000000000000003fULL, 0xfffffffffffffe00ULL, 0x000000000000003fULL,
+    0xfffffffffffffe80ULL, 0x000000000000003fULL, 0xffffffffffffff80ULL, 0x000000000000003fULL,
+    0xffffffffffffffe0ULL, 0x000000000000003fULL, 0xffff7fffffffffe0ULL, 0x000000000000003fULL,
+    0xfffe3ffffffffffcULL, 0x000000000000003fULL, 0xffff1ffffffffffcULL, 0x000000000000003fULL,
+    0xffff0bfffffffffeULL, 0x000000000000003fULL, 0xffff02fffffffffeULL, 0x000000000000003fULL,
+    0xffff007ffffffffeULL, 0x000000000000003fULL, 0xffff007ffffffffeULL, 0x000000000000003fULL,
+    0xffff000ffffffffeULL, 0x000000000000003fULL, 0xffff000ffffffffeULL, 0x000000000000003fULL,
+    0xffff000ffffffffcULL, 0x000000000000003fULL, 0xffff0007fffffffcULL, 0x000000000000003fULL,
+    0xffff0007fffffffcULL, 0x000000000000003fULL, 0xffff0007fffffffcULL, 0x00000000000001ffULL,
+    0xffff0007fffffff8ULL, 0x00000000000001ffULL, 0xffff8003fffffff0ULL, 0x00000000000001ffULL,
+    0xffff8000fffffff0ULL, 0x00000000000001ffULL, 0xffff8000fffffff0ULL, 0x00000000000001ffULL,
+    0xffff8002fffffff0ULL, 0x00000000000001ffULL, 0xffff8000ffffffc0ULL, 0x00000000000000ffULL,
+    0xffffa001ffffffe0ULL, 0x00000000000005ffULL, 0xffffe001ffffffe0ULL, 0x00000000000007ffULL,
+    0xffffe001ffffffc0ULL, 0x00000000000007ffULL, 0xffffe001ffffffc0ULL, 0x00000000000007ffULL,
+    0xffffe001ffffffc0ULL, 0x00000000000007ffULL, 0xffffe001ffffff00ULL, 0x0000000000001fffULL,
+    0xffffc001ffffff80ULL, 0x0000000000001fffULL, 0xffff0001ffffff80ULL, 0x0000000000000fffULL,
+    0xffff0000fffffe00ULL, 0x0000000000007fffULL, 0xffff0000fffffc00ULL, 0x000000000001ffffULL,
+    0xffff0005ffffff00ULL, 0x000000000000ffffULL, 0xffff0007fffffe00ULL, 0x00000000000dffffULL,
+    0xffff0007fffffe00ULL, 0x00000000080fffffULL, 0xffff0007fffffc00ULL, 0x000000000fffffffULL,
+    0xffff000ffffffc00ULL, 0x00000000dfffffffULL, 0xffff800ffffffc00ULL, 0x00000000ffffffffULL,
+    0xffff800ffffffc00ULL, 0x00000003ffffffffULL, 0xffff800ffffff000ULL, 0x00000003ffffffffULL,
+    0xffff000ffffff000ULL, 0x00000003ffffffffULL, 0xffff000ffffff000ULL, 0x0000000fffffffffULL,
+    0xffff000ffffff000ULL, 0x0000000fffffffffULL, 0xffff000fffffe000ULL, 0x0000000fffffffffULL,
+    0xffff000fffff8000ULL, 0x0000000fffffffffULL, 0xffff0003ffffc000ULL, 0x0000000fffffffffULL,
+    0xffff0001ffff0000ULL, 0x0000000fffffffffULL, 0xffff0001ffff0000ULL, 0x0000000fffffffffULL,
+    0xffff8001fffe0000ULL, 0x0000000fffffffffULL, 0xffff8001fffa0000ULL, 0x0000000fffffffffULL,
+    0xffff8000ffe80000ULL, 0x00000007fffe1fffULL, 0x00000000ffc00000ULL, 0x00000007fffdc000ULL,
+};
+
+// img/walk1.png mirrored, 101x260
+static const uint64_t walk1_left_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001fff000000000ULL, 0x0000000000000000ULL,
+    0x0001fff000000000ULL, 0x0000000000000000ULL, 0x003ffff780000000ULL, 0x0000000000000000ULL,
+    0x003ffffff0000000ULL, 0x0000000000000000ULL, 0x077fffffff000000ULL, 0x0000000000000000ULL,
+    0x07ffffffff400000ULL, 0x0000000000000000ULL, 0x83ffffffffc00000ULL, 0x0000000000000000ULL,
+    0x77fffffffff00000ULL, 0x0000000000000000ULL, 0x7ffffffffff80000ULL, 0x0000000000000000ULL,
+    0x7ffffffffff80000ULL, 0x0000000000000000ULL, 0xfffffffffffe0000ULL, 0x0000000000000001ULL,
+    0xffffffffffff8000ULL, 0x0000000000000001ULL, 0xffffffffffff8000ULL, 0x000000000000000bULL,
+    0xffffffffffff8000ULL, 0x000000000000000bULL, 0xffffffffffffe000ULL, 0x000000000000001fULL,
+    0xfffffffffffff000ULL, 0x000000000000001fULL, 0xffffffffffffe000ULL, 0x000000000000001fULL,
+    0xfffffffffffff000ULL, 0x000000000000001fULL, 0xfffffffffffffc00ULL, 0x000000000000007fULL,
+    0xfffffffffffffc00ULL, 0x000000000000007fULL, 0xfffffffffffffe00ULL, 0x000000000000007fULL,
+    0xfffffffffffffc00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffff00ULL, 0x000000000000007fULL,
+    0xffffffffffffff00ULL, 0x000000000000007fULL, 0xffffffffffffcf00ULL, 0x000000000000007fULL,
+    0xffffffffffff8f00ULL, 0x000000000000000fULL, 0xffffffffffffc800ULL, 0x000000000000001fULL,
+    0xffffffffffff4e00ULL, 0x000000000000001fULL, 0xfffffffffffe0e00ULL, 0x000000000000001fULL,
+    0xffffffffffff0000ULL, 0x0000000000000017ULL, 0xffffffffffff0000ULL, 0x0000000000000003ULL,
+    0xfffffffffff80000ULL, 0x0000000000000007ULL, 0xfffffffffffc0000ULL, 0x0000000000000007ULL,
+    0xfffffffffffc0000ULL, 0x0000000000000007ULL, 0xfffffffffffc0000ULL, 0x0000000000000007ULL,
+    0xfffffffffffc0000ULL, 0x0000000000000003ULL, 0xfffffffffffc0000ULL, 0x0000000000000001ULL,
+    0x7ffffffffffc0000ULL, 0x0000000000000001ULL, 0x7ffffffffffc0000ULL, 0x0000000000000000ULL,
+    0x37fffffffffc0000ULL, 0x0000000000000000ULL, 0x047ffffffffc0000ULL, 0x0000000000000000ULL,
+    0x017ffffffffc0000ULL, 0x0000000000000000ULL, 0x003ffffffffc0000ULL, 0x0000000000000000ULL,
+    0x007ffffffffc0000ULL, 0x0000000000000000ULL, 0x007ffffffff00000ULL, 0x0000000000000000ULL,
+    0x807ffffffff80000ULL, 0x00000000000007ffULL, 0x80fffffffff80000ULL, 0x0000000000001fffULL,
+    0xffffffffffc00000ULL, 0x0000000000000fffULL, 0xffffffffffe00000ULL, 0x0000000000001fffULL,
+    0xffffffffff800000ULL, 0x000000000001bfffULL, 0xffffffffff800000ULL, 0x000000000001ffffULL,
+    0xfffffffffe000000ULL, 0x000000000001ffffULL, 0xfffffffffe000000ULL, 0x000000000000ffffULL,
+    0xffffffffdc000000ULL, 0x000000000005ffffULL, 0xfffffff000000000ULL, 0x000000000007ffffULL,
+    0xfffffff000000000ULL, 0x000000000007ffffULL, 0xfffffff000000000ULL, 0x000000000003ffffULL,
+    0xfffffffe00000000ULL, 0x000000000003ffffULL, 0xfffffffe00000000ULL, 0x000000000003ffffULL,
+    0xffffffff80000000ULL, 0x000000000007ffffULL, 0xffffffff80000000ULL, 0x00000000001fffffULL,
+    0xffffffff00000000ULL, 0x00000000001fffffULL, 0xffffffffa0000000ULL, 0x00000000001fffffULL,
+    0xffffffffe0000000ULL, 0x00000000001fffffULL, 0xffffffffe0000000ULL, 0x00000000001fffffULL,
+    0xffffffffe0000000ULL, 0x00000000000fffffULL, 0xffffffffe0000000ULL, 0x00000000000fffffULL,
+    0xffffffffe0000000ULL, 0x00000000000fffffULL, 0xffffffffe0000000ULL, 0x00000000001fffffULL,
+    0xffffffffe0000000ULL, 0x00000000001fffffULL, 0xffffffffe0000000ULL, 0x00000000003fffffULL,
+    0xfffffffffc000000ULL, 0x00000000003fffffULL, 0xfffffffff0000000ULL, 0x00000000007fffffULL,
+    0xfffffffff0000000ULL, 0x00000000007fffffULL, 0xfffffffff0000000ULL, 0x00000000007fffffULL,
+    0xfffffffff0000000ULL, 0x00000000007fffffULL, 0xfffffffff0000000ULL, 0x00000000007fffffULL,
+    0xfffffffff0000000ULL, 0x0000000001ffffffULL, 0xfffffffff0000000ULL, 0x0000000000ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000001ffffffULL, 0xfffffffff0000000ULL, 0x0000000003ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000003ffffffULL, 0xfffffffff0000000ULL, 0x000000000fffffffULL,
+    0xfffffffff0000000ULL, 0x000000000fffffffULL, 0xfffffffff8000000ULL, 0x0000000007ffffffULL,
+    0xfffffffff8000000ULL, 0x000000001fffffffULL, 0xfffffffff8000000ULL, 0x000000001fffffffULL,
+    0xfffffffff0000000ULL, 0x000000000fffffffULL, 0xfffffffff0000000ULL, 0x000000007fffffffULL,
+    0xfffffffff0000000ULL, 0x00000000ffffffffULL, 0xfffffffff0000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff0000000ULL, 0x00000001ffffffffULL, 0xfffffffff8000000ULL, 0x00000001ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000001ffffffffULL, 0xffffffffe8000000ULL, 0x00000007ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000007ffffffffULL, 0xffffffffe0000000ULL, 0x00000003ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000007ffffffffULL, 0xffffffffe0000000ULL, 0x0000001fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000001fffffffffULL, 0xffffffffe0000000ULL, 0x0000001fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000001fffffffffULL, 0xffffffffe0000000ULL, 0x0000001fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000001fffffffffULL, 0xffffffffe0000000ULL, 0x0000001fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000001fffffffffULL, 0xffffffffe0000000ULL, 0x0000001fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000001fffffffffULL, 0xffffffffe0000000ULL, 0x0000001fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000001fffffffffULL, 0xffffffffe0000000ULL, 0x0000000fffffffffULL,
+    0xffffffffe0000000ULL, 0x00000007ffffffffULL, 0xffffffffe0000000ULL, 0x0000000fffffffffULL,
+    0xffffffffe0000000ULL, 0x0000000fffffffffULL, 0xffffffffe0000000ULL, 0x0000000fffffffffULL,
+    0xfffffffff0000000ULL, 0x0000000fffffffffULL, 0xfffffffff0000000ULL, 0x00000005ffffffffULL,
+    0xfffffffff0000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000003ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000000ffffffffULL, 0xfffffffff8000000ULL, 0x000000007fffffffULL,
+    0xfffffffff8000000ULL, 0x000000001fffffffULL, 0xfffffffff8000000ULL, 0x000000003fffffffULL,
+    0xfffffffff8000000ULL, 0x000000003fffffffULL, 0xfffffffff8000000ULL, 0x000000003fffffffULL,
+    0xfffffffff8000000ULL, 0x000000003fffffffULL, 0xfffffffff8000000ULL, 0x000000003fffffffULL,
+    0xfffffffff8000000ULL, 0x0000000007ffffffULL, 0xfffffffff8000000ULL, 0x000000000bffffffULL,
+    0xfffffffff8000000ULL, 0x000000000fffffffULL, 0xfffffffff8000000ULL, 0x000000000fffffffULL,
+    0xfffffffff8000000ULL, 0x000000000fffffffULL, 0xfffffffff8000000ULL, 0x000000000fffffffULL,
+    0xfffffffffc000000ULL, 0x000000000fffffffULL, 0xfffffffffc000000ULL, 0x000000000fffffffULL,
+    0xfffffffffc000000ULL, 0x000000000fffffffULL, 0xfffffffffc000000ULL, 0x000000000fffffffULL,
+    0xfffffffffc000000ULL, 0x000000000fffffffULL, 0xfffffffffc000000ULL, 0x000000000fffffffULL,
+    0xfffffffffc000000ULL, 0x000000000fffffffULL, 0xfffffffffc000000ULL, 0x000000000fffffffULL,
+    0xfffffffffc000000ULL, 0x0000000003ffffffULL, 0xfffffffffc000000ULL, 0x0000000007ffffffULL,
+    0xffffffffe0000000ULL, 0x0000000000ffffffULL, 0xfffffffff0000000ULL, 0x0000000000bebeffULL,
+    0xffffffffe0000000ULL, 0x00000000001e7e1fULL, 0xffffffffe0000000ULL, 0x000000000000001fULL,
+    0xffffffffe0000000ULL, 0x000000000000000fULL, 0xffffffffe0000000ULL, 0x000000000000000fULL,
+    0xffffffffe0000000ULL, 0x000000000000000fULL, 0xffffffffc0000000ULL, 0x0000000000000007ULL,
+    0xffffffffc0000000ULL, 0x0000000000000007ULL, 0xffffffffc0000000ULL, 0x0000000000000007ULL,
+    0xffffffffc0000000ULL, 0x0000000000000007ULL, 0xffffffffc0000000ULL, 0x0000000000000003ULL,
+    0xffffffffc0000000ULL, 0x0000000000000000ULL, 0xffffffffc0000000ULL, 0x0000000000000000ULL,
+    0xffffffffc0000000ULL, 0x0000000000000000ULL, 0xffffffffc0000000ULL, 0x0000000000000001ULL,
+    0xffffffff80000000ULL, 0x0000000000000000ULL, 0xffffffffc0000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x0000000000000000ULL, 0xfffffffff0000000ULL, 0x0000000000000000ULL,
+    0x7ffffffff0000000ULL, 0x0000000000000000ULL, 0x7ffffffff8000000ULL, 0x0000000000000000ULL,
+    0x3ffffffff8000000ULL, 0x0000000000000000ULL, 0x1ffffffff8000000ULL, 0x0000000000000000ULL,
+    0x1ffffffff8000000ULL, 0x0000000000000000ULL, 0x1ffffffff8000000ULL, 0x0000000000000000ULL,
+    0xfffffffff8000000ULL, 0x0000000000000000ULL, 0xfffffffff8000000ULL, 0x0000000000000000ULL,
+    0xfffffffff8000000ULL, 0x0000000000000007ULL, 0xfffffffff8000000ULL, 0x0000000000000017ULL,
+    0xfffffffff0000000ULL, 0x000000000000001fULL, 0xffffffffc0000000ULL, 0x000000000000003fULL,
+    0xffffffffc0000000ULL, 0x00000000000003ffULL, 0xffffffffe0000000ULL, 0x00000000000001ffULL,
+    0xffffffffc0000000ULL, 0x00000000000007ffULL, 0xffffffffc0000000ULL, 0x00000000000037ffULL,
+    0xffffffffc0000000ULL, 0x000000000001bfffULL, 0xffffffffc0000000ULL, 0x000000000001ffffULL,
+    0xffffffff80000000ULL, 0x000000000007ffffULL, 0xffffffff00000000ULL, 0x000000000007ffffULL,
+    0xffffffff80000000ULL, 0x00000000001fffffULL, 0xffffffff80000000ULL, 0x0000000000dfffffULL,
+    0xffffffff80000000ULL, 0x0000000000ffffffULL, 0xffffffff80000000ULL, 0x000000000fffffffULL,
+    0xffffffff80000000ULL, 0x000000002fffffffULL, 0xffffffff80000000ULL, 0x000000003fffffffULL,
+    0xffffffff80000000ULL, 0x00000000ffffffffULL, 0xffdfffff80000000ULL, 0x00000000ffffffffULL,
+    0xff8fffff80000000ULL, 0x00000007ffffffffULL, 0xff1fffff80000000ULL, 0x00000007ffffffffULL,
+    0xfa1fffff80000000ULL, 0x0000000fffffffffULL, 0xe81fffff80000000ULL, 0x0000000fffffffffULL,
+    0xc01fffff80000000ULL, 0x0000000fffffffffULL, 0xc01fffff80000000ULL, 0x0000000fffffffffULL,
+    0x001fffff80000000ULL, 0x0000000ffffffffeULL, 0x001fffff80000000ULL, 0x0000000ffffffffeULL,
+    0x001fffff80000000ULL, 0x00000007fffffffeULL, 0x001fffff80000000ULL, 0x00000007fffffffcULL,
+    0x001fffff80000000ULL, 0x00000007fffffffcULL, 0x001ffffff0000000ULL, 0x00000007fffffffcULL,
+    0x001ffffff0000000ULL, 0x00000003fffffffcULL, 0x003ffffff0000000ULL, 0x00000001fffffff8ULL,
+    0x003ffffff0000000ULL, 0x00000001ffffffe0ULL, 0x003ffffff0000000ULL, 0x00000001ffffffe0ULL,
+    0x003ffffff0000000ULL, 0x00000001ffffffe8ULL, 0x003fffffe0000000ULL, 0x000000007fffffe0ULL,
+    0x00bffffff4000000ULL, 0x00000000fffffff0ULL, 0x00fffffffc000000ULL, 0x00000000fffffff0ULL,
+    0x00fffffffc000000ULL, 0x000000007ffffff0ULL, 0x00fffffffc000000ULL, 0x000000007ffffff0ULL,
+    0x00fffffffc000000ULL, 0x000000007ffffff0ULL, 0x00ffffffff000000ULL, 0x000000001ffffff0ULL,
+    0x007fffffff000000ULL, 0x000000003ffffff0ULL, 0x001ffffffe000000ULL, 0x000000003ffffff0ULL,
+    0x001fffffffc00000ULL, 0x000000000fffffe0ULL, 0x001ffffffff00000ULL, 0x0000000007ffffe0ULL,
+    0x001fffffffe00000ULL, 0x000000001ffffff4ULL, 0x001ffffffff60000ULL, 0x000000000ffffffcULL,
+    0x001ffffffffe0200ULL, 0x000000000ffffffcULL, 0x001ffffffffffe00ULL, 0x0000000007fffffcULL,
+    0x001fffffffffff60ULL, 0x0000000007fffffeULL, 0x003fffffffffffe0ULL, 0x0000000007fffffeULL,
+    0x003ffffffffffff8ULL, 0x0000000007fffffeULL, 0x003ffffffffffff8ULL, 0x0000000001fffffeULL,
+    0x001ffffffffffff8ULL, 0x0000000001fffffeULL, 0x001ffffffffffffeULL, 0x0000000001fffffeULL,
+    0x001ffffffffffffeULL, 0x0000000001fffffeULL, 0x001ffffffffffffeULL, 0x0000000000fffffeULL,
+    0x001ffffffffffffeULL, 0x00000000003ffffeULL, 0x001ffffffffffffeULL, 0x00000000007ffff8ULL,
+    0x001ffffffffffffeULL, 0x00000000001ffff0ULL, 0x001ffffffffffffeULL, 0x00000000001ffff0ULL,
+    0x003ffffffffffffeULL, 0x00000000000ffff0ULL, 0x003ffffffffffffeULL, 0x00000000000bfff0ULL,
+    0x003fffffff0ffffcULL, 0x000000000002ffe0ULL, 0x000000000077fffcULL, 0x0000000000007fe0ULL,
+};
+
+// img/walk2.png, 121x260
+static const uint64_t walk2_right_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000f8fcULL,
+    0x0000000000000000ULL, 0x000000000001fffcULL, 0x6000000000000000ULL, 0x000000000001fffcULL,
+    0xe000000000000000ULL, 0x00000000003fffffULL, 0xfe00000000000000ULL, 0x0000000007ffffffULL,
+    0xfe00000000000000ULL, 0x0000000017ffffffULL, 0xff10000000000000ULL, 0x000000001fffffffULL,
+    0xffe0000000000000ULL, 0x00000000ffffffffULL, 0xff80000000000000ULL, 0x00000001ffffffffULL,
+    0xfff8000000000000ULL, 0x00000003ffffffffULL, 0xfff8000000000000ULL, 0x00000003ffffffffULL,
+    0xfffa000000000000ULL, 0x0000000fffffffffULL, 0xfffe000000000000ULL, 0x0000000fffffffffULL,
+    0xffff000000000000ULL, 0x0000001fffffffffULL, 0xffff000000000000ULL, 0x0000003fffffffffULL,
+    0xffffc00000000000ULL, 0x0000003fffffffffULL, 0xffffc00000000000ULL, 0x000000ffffffffffULL,
+    0xffff800000000000ULL, 0x000000ffffffffffULL, 0xfffff00000000000ULL, 0x000001ffffffffffULL,
+    0xffffe00000000000ULL, 0x000003ffffffffffULL, 0xffffe00000000000ULL, 0x000003ffffffffffULL,
+    0xffffe00000000000ULL, 0x000007ffffffffffULL, 0xffffe00000000000ULL, 0x000003ffffffffffULL,
+    0xffffe00000000000ULL, 0x00000fffffffffffULL, 0xffffe00000000000ULL, 0x00000fffffffffffULL,
+    0xffffe00000000000ULL, 0x00000fffffffffffULL, 0xffffe00000000000ULL, 0x00000fffffffffffULL,
+    0xffffe00000000000ULL, 0x00000fffffffffffULL, 0xffffe00000000000ULL, 0x00000fffffffffffULL,
+    0xffffe00000000000ULL, 0x00000fffffffffffULL, 0xffffe00000000000ULL, 0x00000fffffffffffULL,
+    0xffffe00000000000ULL, 0x00000fffffffffffULL, 0xffffe00000000000ULL, 0x00000fffffffffffULL,
+    0xffffe00000000000ULL, 0x00000fffffffffffULL, 0xffffe00000000000ULL, 0x00000fffffffffffULL,
+    0xfffff00000000000ULL, 0x00000f3fffffffffULL, 0xffffc00000000000ULL, 0x00000e1fffffffffULL,
+    0xffffc00000000000ULL, 0x00000f3fffffffffULL, 0xffffc00000000000ULL, 0x00000f3fffffffffULL,
+    0xffffc00000000000ULL, 0x0000073fffffffffULL, 0xffffc00000000000ULL, 0x0000073fffffffffULL,
+    0xffff000000000000ULL, 0x0000010fffffffffULL, 0xffff000000000000ULL, 0x0000010fffffffffULL,
+    0xffff000000000000ULL, 0x00000003ffffffffULL, 0xffff000000000000ULL, 0x00000003ffffffffULL,
+    0xffff000000000000ULL, 0x00000003ffffffffULL, 0xffff000000000000ULL, 0x00000003ffffffffULL,
+    0xfffc000000000000ULL, 0x00000003ffffffffULL, 0xfff8000000000000ULL, 0x00000003ffffffffULL,
+    0xfff8000000000000ULL, 0x00000003ffffffffULL, 0xffe0000000000000ULL, 0x00000003ffffffffULL,
+    0xff80000000000000ULL, 0x00000003ffffffffULL, 0xfc00000000000000ULL, 0x00000003ffffffffULL,
+    0xc400000000000000ULL, 0x00000003ffffffffULL, 0xc000000000000000ULL, 0x00000003ffffffffULL,
+    0xc000000000000000ULL, 0x00000003ffffffffULL, 0xc000000000000000ULL, 0x00000001ffffffffULL,
+    0xc07f800000000000ULL, 0x00000001ffffffffULL, 0x8070300000000000ULL, 0x00000001ffffffffULL,
+    0xdfffe80000000000ULL, 0x00000000ffffffffULL, 0xfffff80000000000ULL, 0x00000000ffffffffULL,
+    0xffffff0000000000ULL, 0x000000001fffffffULL, 0xffffff4000000000ULL, 0x000000003fffffffULL,
+    0xffffffc000000000ULL, 0x0000000017ffffffULL, 0xffffffc000000000ULL, 0x0000000007ffffffULL,
+    0xffffffc000000000ULL, 0x0000000003fbffffULL, 0xfffffff000000000ULL, 0x000000000001ffffULL,
+    0xfffffff000000000ULL, 0x000000000003ffffULL, 0xfffffff000000000ULL, 0x00000000000fffffULL,
+    0xfffffff000000000ULL, 0x00000000007fffffULL, 0xfffffff000000000ULL, 0x00000000007fffffULL,
+    0xfffffff800000000ULL, 0x0000000001ffffffULL, 0xfffffff800000000ULL, 0x0000000001ffffffULL,
+    0xfffffff800000000ULL, 0x0000000000ffffffULL, 0xfffffff800000000ULL, 0x0000000007ffffffULL,
+    0xfffffff800000000ULL, 0x0000000007ffffffULL, 0xfffffff800000000ULL, 0x0000000007ffffffULL,
+    0xfffffff800000000ULL, 0x0000000007ffffffULL, 0xfffffff800000000ULL, 0x0000000007ffffffULL,
+    0xffffffe000000000ULL, 0x0000000007ffffffULL, 0xfffffff000000000ULL, 0x0000000007ffffffULL,
+    0xfffffff800000000ULL, 0x0000000007ffffffULL, 0xfffffff800000000ULL, 0x0000000003ffffffULL,
+    0xffffffe800000000ULL, 0x000000003fffffffULL, 0xfffffffc00000000ULL, 0x000000002fffffffULL,
+    0xfffffffc00000000ULL, 0x000000002fffffffULL, 0xfffffffc00000000ULL, 0x000000003fffffffULL,
+    0xfffffffc00000000ULL, 0x000000003fffffffULL, 0xfffffffc00000000ULL, 0x000000003fffffffULL,
+    0xfffffffc00000000ULL, 0x000000003fffffffULL, 0xffffffff00000000ULL, 0x000000002fffffffULL,
+    0xfffffffe00000000ULL, 0x000000002fffffffULL, 0xffffffff80000000ULL, 0x000000002fffffffULL,
+    0xffffffff80000000ULL, 0x000000002fffffffULL, 0xffffffff80000000ULL, 0x000000002fffffffULL,
+    0xffffffffc0000000ULL, 0x000000002fffffffULL, 0xffffffff80000000ULL, 0x000000002fffffffULL,
+    0xffffffffe0000000ULL, 0x000000000fffffffULL, 0xfffffffff0000000ULL, 0x000000000fffffffULL,
+    0xfffffffff0000000ULL, 0x000000002fffffffULL, 0xfffffffff8000000ULL, 0x000000000fffffffULL,
+    0xfffffffff8000000ULL, 0x000000001fffffffULL, 0xfffffffff8000000ULL, 0x000000001fffffffULL,
+    0xfffffffffe000000ULL, 0x000000001fffffffULL, 0xfffffffffe000000ULL, 0x000000001fffffffULL,
+    0xfffffffffe000000ULL, 0x000000000fffffffULL, 0xffffffffff800000ULL, 0x000000000fffffffULL,
+    0xffffffffff800000ULL, 0x000000000fffffffULL, 0xffffffffff800000ULL, 0x000000000fffffffULL,
+    0xffffffffff800000ULL, 0x000000000fffffffULL, 0xffffffffffc00000ULL, 0x000000000fffffffULL,
+    0xffffffffffc00000ULL, 0x000000000fffffffULL, 0xffffffffffc00000ULL, 0x000000000fffffffULL,
+    0xffffffffffc00000ULL, 0x000000000fffffffULL, 0xffffffffffc00000ULL, 0x000000000fffffffULL,
+    0xffffffffffc00000ULL, 0x000000000fffffffULL, 0xffffffffffc00000ULL, 0x000000000fffffffULL,
+    0xffffffffffc00000ULL, 0x0000000007ffffffULL, 0xffffffffffc00000ULL, 0x0000000017ffffffULL,
+    0xffffffffffc00000ULL, 0x0000000017ffffffULL, 0xffffffffffc00000ULL, 0x0000000017ffffffULL,
+    0xffffffffffc00000ULL, 0x0000000017ffffffULL, 0xffffffffff800000ULL, 0x000000001fffffffULL,
+    0xffffffffff800000ULL, 0x000000001fffffffULL, 0xffffffffff800000ULL, 0x000000001fffffffULL,
+    0xffffffffff000000ULL, 0x000000001fffffffULL, 0xffffffffff000000ULL, 0x000000001fffffffULL,
+    0xffffffffff000000ULL, 0x000000003fffffffULL, 0xffffffffff000000ULL, 0x000000003fffffffULL,
+    0xffffffffff000000ULL, 0x000000003fffffffULL, 0xfffffffffe000000ULL, 0x000000003fffffffULL,
+    0xfffffffffe000000ULL, 0x000000003fffffffULL, 0xfffffffffe000000ULL, 0x000000003fffffffULL,
+    0xfffffffffe000000ULL, 0x000000003fffffffULL, 0xfffffffffe000000ULL, 0x000000003fffffffULL,
+    0xfffffffffe000000ULL, 0x000000003fffffffULL, 0xfffffffffe000000ULL, 0x000000003fffffffULL,
+    0xfffffffffe000000ULL, 0x000000003fffffffULL, 0xfffffffffe000000ULL, 0x000000003fffffffULL,
+    0xfffffffffc000000ULL, 0x000000003fffffffULL, 0xfffffffffc000000ULL, 0x000000003fffffffULL,
+    0xfffffffff0000000ULL, 0x000000003fffffffULL, 0xfffffffff0000000ULL, 0x000000003fffffffULL,
+    0xffffffffc0000000ULL, 0x000000003fffffffULL, 0xffffffffc0000000ULL, 0x000000003fffffffULL,
+    0xffffffffc0000000ULL, 0x000000003fffffffULL, 0xffffffffc0000000ULL, 0x000000003fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffffc0000000ULL, 0x000000001fffffffULL,
+    0xffffffffc0000000ULL, 0x000000001fffffffULL, 0xffffffff00000000ULL, 0x000000003fffffffULL,
+    0xffffffff80000000ULL, 0x000000000fffffffULL, 0xffffffff80000000ULL, 0x000000000bffffffULL,
+    0xffffffff80000000ULL, 0x0000000007ffffffULL, 0xffffffff80000000ULL, 0x0000000007ffffffULL,
+    0xffffffff80000000ULL, 0x0000000000ffffffULL, 0xffffffff80000000ULL, 0x0000000001ffffffULL,
+    0xffffffff80000000ULL, 0x0000000001ffffffULL, 0xffffffff80000000ULL, 0x0000000000ffffffULL,
+    0xffffffff80000000ULL, 0x00000000007fffffULL, 0xffffffff80000000ULL, 0x0000000000ffffffULL,
+    0xffffffff80000000ULL, 0x00000000007fffffULL, 0xffffffff00000000ULL, 0x00000000007fffffULL,
+    0xffffffff00000000ULL, 0x00000000007fffffULL, 0xfffffffd00000000ULL, 0x00000000001fffffULL,
+    0xfffffffc00000000ULL, 0x00000000003fffffULL, 0xffffff7c00000000ULL, 0x00000000003fffffULL,
+    0xffff800000000000ULL, 0x00000000003fffffULL, 0xffff800000000000ULL, 0x00000000000fffffULL,
+    0xffff800000000000ULL, 0x00000000001fffffULL, 0xffff800000000000ULL, 0x00000000001fffffULL,
+    0xffff800000000000ULL, 0x00000000001fffffULL, 0xffff800000000000ULL, 0x00000000000fffffULL,
+    0xffffc00000000000ULL, 0x00000000003fffffULL, 0xffffc00000000000ULL, 0x00000000003fffffULL,
+    0xffffc00000000000ULL, 0x00000000001fffffULL, 0xffffc00000000000ULL, 0x00000000007fffffULL,
+    0xffffe00000000000ULL, 0x00000000007fffffULL, 0xffffe00000000000ULL, 0x0000000001ffffffULL,
+    0xfffff00000000000ULL, 0x0000000000ffffffULL, 0xffffe80000000000ULL, 0x0000000003ffffffULL,
+    0xffffe80000000000ULL, 0x0000000001ffffffULL, 0xfffff80000000000ULL, 0x0000000007ffffffULL,
+    0xfffff80000000000ULL, 0x0000000007ffffffULL, 0xfffff80000000000ULL, 0x0000000003ffffffULL,
+    0xfffff80000000000ULL, 0x000000000fffffffULL, 0xffffff0000000000ULL, 0x000000000fffffffULL,
+    0xffffff4000000000ULL, 0x000000000fffffffULL, 0xffffffb000000000ULL, 0x000000000fffffffULL,
+    0xfffffff800000000ULL, 0x000000000ffffff9ULL, 0xfffffff800000000ULL, 0x000000000ffffff0ULL,
+    0xfffffffc00000000ULL, 0x000000000ffffff9ULL, 0xffffffff00000000ULL, 0x000000000ffffff8ULL,
+    0xffffffff00000000ULL, 0x000000000fffffe0ULL, 0xffffffffc0000000ULL, 0x000000000fffffe0ULL,
+    0xffffffffe0000000ULL, 0x000000000fffffe0ULL, 0x3ffffffff0000000ULL, 0x000000000fffffe0ULL,
+    0x3ffffffff8000000ULL, 0x0000000003ffffe0ULL, 0x3ffffffff0000000ULL, 0x0000000003fffff0ULL,
+    0x3ffffffffe000000ULL, 0x0000000003fffff0ULL, 0x0ffffffffc000000ULL, 0x0000000003fffff0ULL,
+    0x05ffffffff000000ULL, 0x0000000003fffff0ULL, 0x01ffffffff600000ULL, 0x0000000003fffff0ULL,
+    0x00ffffffffa00000ULL, 0x0000000003fffff0ULL, 0x003ffffffff80000ULL, 0x0000000003fffff0ULL,
+    0x000ffffffffc0000ULL, 0x0000000003fffff0ULL, 0x0007fffffffe0000ULL, 0x0000000003fffff0ULL,
+    0x0007fffffffe0000ULL, 0x0000000003fffff0ULL, 0x0001ffffffffc000ULL, 0x0000000003fffff0ULL,
+    0x0000ffffffffd800ULL, 0x0000000003fffff0ULL, 0x00003ffffffffa00ULL, 0x0000000003fffff0ULL,
+    0x00003fffffffff80ULL, 0x0000000003fffff0ULL, 0x00001fffffffffe0ULL, 0x0000000003fffff0ULL,
+    0x000007ffffffffe0ULL, 0x0000000003fffff0ULL, 0x000007fffffffff8ULL, 0x0000000003fffff0ULL,
+    0x000001fffffffff8ULL, 0x0000000003fffff0ULL, 0x000001fffffffffeULL, 0x0000000003fffff0ULL,
+    0x000000ffffffffffULL, 0x0000000003fffff0ULL, 0x000000ffffffffffULL, 0x0000000003fffff0ULL,
+    0x0000007fffffffffULL, 0x0000000003fffff0ULL, 0x0000001fffffffffULL, 0x000000001ffffff0ULL,
+    0x0000001fffffffffULL, 0x000000001ffffff0ULL, 0x0000001ffffffff8ULL, 0x000000001ffffff0ULL,
+    0x0000001ffffffffcULL, 0x000000001ffffff8ULL, 0x0000001ffffffffcULL, 0x000000000ffffffcULL,
+    0x00000017fffffff8ULL, 0x000000001ffffffcULL, 0x00000003fffffff0ULL, 0x000000003ffffffcULL,
+    0x00000007fffffff0ULL, 0x000000007ffffffcULL, 0x00000007ffffffe0ULL, 0x000000003fffffe0ULL,
+    0x00000007ffffffc0ULL, 0x000000003ffffff0ULL, 0x00000007ffffffe0ULL, 0x00000000fffffff0ULL,
+    0x00000001ffffff80ULL, 0x00000001fffffffcULL, 0x00000003ffffffc0ULL, 0x00000001fffffff4ULL,
+    0x00000003ffffffc0ULL, 0x00000000fffffffcULL, 0x00000003ffffff80ULL, 0x00000003fffffffcULL,
+    0x00000003ffffff80ULL, 0x00000003fffffff4ULL, 0x00000003fffffe00ULL, 0x0000000ffffffff8ULL,
+    0x00000003fffffd00ULL, 0x0000000fffffffe0ULL, 0x00000003fffffe00ULL, 0x0000003ffffffff0ULL,
+    0x00000001fffffe00ULL, 0x000000bffffffff0ULL, 0x00000007fffffc00ULL, 0x0000ffffffffffe0ULL,
+    0x0000000ffffffc00ULL, 0x0000ffffffffffe0ULL, 0x0000001ffffffc00ULL, 0x000fffffffffffe0ULL,
+    0x0000001ffffff800ULL, 0x000fffffffffffe0ULL, 0x000000fffffff800ULL, 0x001fffffffffffe0ULL,
+    0x000000fffffff800ULL, 0x001fffffffffffe0ULL, 0x000001ffffffe000ULL, 0x007fffffffffffe0ULL,
+    0x000001fffffff000ULL, 0x01ffffffffffffe0ULL, 0x000001ffffffc000ULL, 0x01ffffffffffffe0ULL,
+    0x000001ffffffe000ULL, 0x01ffffffffffffe0ULL, 0x000001ffffff8000ULL, 0x01ffffffffffffe0ULL,
+    0x000001ffffff8000ULL, 0x01ffffffffffffe0ULL, 0x000001ffffff8000ULL, 0x01ffffffffffffe0ULL,
+    0x000001fffffd0000ULL, 0x01ffffffffffffe0ULL, 0x000000fffff80000ULL, 0x01ffffffffffffe0ULL,
+    0x000000fffff80000ULL, 0x01ffffffffffffe0ULL, 0x000000bffff00000ULL, 0x017fffffffffffe0ULL,
+    0x0000007fffe00000ULL, 0x004ffe37e00001c0ULL, 0x0000000000000000ULL, 0x0000000000007000ULL,
+};
+
+// img/walk2.png mirrored, 121x260
+static const uint64_t walk2_left_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x007e3e0000000000ULL, 0x0000000000000000ULL,
+    0x007fff0000000000ULL, 0x0000000000000000ULL, 0x0c7fff0000000000ULL, 0x0000000000000000ULL,
+    0x0ffffff800000000ULL, 0x0000000000000000ULL, 0xffffffffc0000000ULL, 0x0000000000000000ULL,
+    0xffffffffd0000000ULL, 0x0000000000000000ULL, 0xfffffffff0000000ULL, 0x0000000000000011ULL,
+    0xfffffffffe000000ULL, 0x000000000000000fULL, 0xffffffffff000000ULL, 0x0000000000000003ULL,
+    0xffffffffff800000ULL, 0x000000000000003fULL, 0xffffffffff800000ULL, 0x000000000000003fULL,
+    0xffffffffffe00000ULL, 0x00000000000000bfULL, 0xffffffffffe00000ULL, 0x00000000000000ffULL,
+    0xfffffffffff00000ULL, 0x00000000000001ffULL, 0xfffffffffff80000ULL, 0x00000000000001ffULL,
+    0xfffffffffff80000ULL, 0x00000000000007ffULL, 0xfffffffffffe0000ULL, 0x00000000000007ffULL,
+    0xfffffffffffe0000ULL, 0x00000000000003ffULL, 0xffffffffffff0000ULL, 0x0000000000001fffULL,
+    0xffffffffffff8000ULL, 0x0000000000000fffULL, 0xffffffffffff8000ULL, 0x0000000000000fffULL,
+    0xffffffffffffc000ULL, 0x0000000000000fffULL, 0xffffffffffff8000ULL, 0x0000000000000fffULL,
+    0xffffffffffffe000ULL, 0x0000000000000fffULL, 0xffffffffffffe000ULL, 0x0000000000000fffULL,
+    0xffffffffffffe000ULL, 0x0000000000000fffULL, 0xffffffffffffe000ULL, 0x0000000000000fffULL,
+    0xffffffffffffe000ULL, 0x0000000000000fffULL, 0xffffffffffffe000ULL, 0x0000000000000fffULL,
+    0xffffffffffffe000ULL, 0x0000000000000fffULL, 0xffffffffffffe000ULL, 0x0000000000000fffULL,
+    0xffffffffffffe000ULL, 0x0000000000000fffULL, 0xffffffffffffe000ULL, 0x0000000000000fffULL,
+    0xffffffffffffe000ULL, 0x0000000000000fffULL, 0xffffffffffffe000ULL, 0x0000000000000fffULL,
+    0xfffffffffff9e000ULL, 0x0000000000001fffULL, 0xfffffffffff0e000ULL, 0x00000000000007ffULL,
+    0xfffffffffff9e000ULL, 0x00000000000007ffULL, 0xfffffffffff9e000ULL, 0x00000000000007ffULL,
+    0xfffffffffff9c000ULL, 0x00000000000007ffULL, 0xfffffffffff9c000ULL, 0x00000000000007ffULL,
+    0xffffffffffe10000ULL, 0x00000000000001ffULL, 0xffffffffffe10000ULL, 0x00000000000001ffULL,
+    0xffffffffff800000ULL, 0x00000000000001ffULL, 0xffffffffff800000ULL, 0x00000000000001ffULL,
+    0xffffffffff800000ULL, 0x00000000000001ffULL, 0xffffffffff800000ULL, 0x00000000000001ffULL,
+    0xffffffffff800000ULL, 0x000000000000007fULL, 0xffffffffff800000ULL, 0x000000000000003fULL,
+    0xffffffffff800000ULL, 0x000000000000003fULL, 0xffffffffff800000ULL, 0x000000000000000fULL,
+    0xffffffffff800000ULL, 0x0000000000000003ULL, 0x7fffffffff800000ULL, 0x0000000000000000ULL,
+    0x47ffffffff800000ULL, 0x0000000000000000ULL, 0x07ffffffff800000ULL, 0x0000000000000000ULL,
+    0x07ffffffff800000ULL, 0x0000000000000000ULL, 0x07ffffffff000000ULL, 0x0000000000000000ULL,
+    0x07ffffffff000000ULL, 0x00000000000003fcULL, 0x03ffffffff000000ULL, 0x000000000000181cULL,
+    0xf7fffffffe000000ULL, 0x0000000000002fffULL, 0xfffffffffe000000ULL, 0x0000000000003fffULL,
+    0xfffffffff0000000ULL, 0x000000000001ffffULL, 0xfffffffff8000000ULL, 0x000000000005ffffULL,
+    0xffffffffd0000000ULL, 0x000000000007ffffULL, 0xffffffffc0000000ULL, 0x000000000007ffffULL,
+    0xffffffbf80000000ULL, 0x000000000007ffffULL, 0xffffff0000000000ULL, 0x00000000001fffffULL,
+    0xffffff8000000000ULL, 0x00000000001fffffULL, 0xffffffe000000000ULL, 0x00000000001fffffULL,
+    0xfffffffc00000000ULL, 0x00000000001fffffULL, 0xfffffffc00000000ULL, 0x00000000001fffffULL,
+    0xffffffff00000000ULL, 0x00000000003fffffULL, 0xffffffff00000000ULL, 0x00000000003fffffULL,
+    0xfffffffe00000000ULL, 0x00000000003fffffULL, 0xffffffffc0000000ULL, 0x00000000003fffffULL,
+    0xffffffffc0000000ULL, 0x00000000003fffffULL, 0xffffffffc0000000ULL, 0x00000000003fffffULL,
+    0xffffffffc0000000ULL, 0x00000000003fffffULL, 0xffffffffc0000000ULL, 0x00000000003fffffULL,
+    0xffffffffc0000000ULL, 0x00000000000fffffULL, 0xffffffffc0000000ULL, 0x00000000001fffffULL,
+    0xffffffffc0000000ULL, 0x00000000003fffffULL, 0xffffffff80000000ULL, 0x00000000003fffffULL,
+    0xfffffffff8000000ULL, 0x00000000002fffffULL, 0xffffffffe8000000ULL, 0x00000000007fffffULL,
+    0xffffffffe8000000ULL, 0x00000000007fffffULL, 0xfffffffff8000000ULL, 0x00000000007fffffULL,
+    0xfffffffff8000000ULL, 0x00000000007fffffULL, 0xfffffffff8000000ULL, 0x00000000007fffffULL,
+    0xfffffffff8000000ULL, 0x00000000007fffffULL, 0xffffffffe8000000ULL, 0x0000000001ffffffULL,
+    0xffffffffe8000000ULL, 0x0000000000ffffffULL, 0xffffffffe8000000ULL, 0x0000000003ffffffULL,
+    0xffffffffe8000000ULL, 0x0000000003ffffffULL, 0xffffffffe8000000ULL, 0x0000000003ffffffULL,
+    0xffffffffe8000000ULL, 0x0000000007ffffffULL, 0xffffffffe8000000ULL, 0x0000000003ffffffULL,
+    0xffffffffe0000000ULL, 0x000000000fffffffULL, 0xffffffffe0000000ULL, 0x000000001fffffffULL,
+    0xffffffffe8000000ULL, 0x000000001fffffffULL, 0xffffffffe0000000ULL, 0x000000003fffffffULL,
+    0xfffffffff0000000ULL, 0x000000003fffffffULL, 0xfffffffff0000000ULL, 0x000000003fffffffULL,
+    0xfffffffff0000000ULL, 0x00000000ffffffffULL, 0xfffffffff0000000ULL, 0x00000000ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000000ffffffffULL, 0xffffffffe0000000ULL, 0x00000003ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000003ffffffffULL, 0xffffffffe0000000ULL, 0x00000003ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000003ffffffffULL, 0xffffffffe0000000ULL, 0x00000007ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000007ffffffffULL, 0xffffffffe0000000ULL, 0x00000007ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000007ffffffffULL, 0xffffffffe0000000ULL, 0x00000007ffffffffULL,
+    0xffffffffe0000000ULL, 0x00000007ffffffffULL, 0xffffffffe0000000ULL, 0x00000007ffffffffULL,
+    0xffffffffc0000000ULL, 0x00000007ffffffffULL, 0xffffffffd0000000ULL, 0x00000007ffffffffULL,
+    0xffffffffd0000000ULL, 0x00000007ffffffffULL, 0xffffffffd0000000ULL, 0x00000007ffffffffULL,
+    0xffffffffd0000000ULL, 0x00000007ffffffffULL, 0xfffffffff0000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff0000000ULL, 0x00000003ffffffffULL, 0xfffffffff0000000ULL, 0x00000003ffffffffULL,
+    0xfffffffff0000000ULL, 0x00000001ffffffffULL, 0xfffffffff0000000ULL, 0x00000001ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000001ffffffffULL, 0xfffffffff8000000ULL, 0x00000001ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000001ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000000ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000000ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000000ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x00000000ffffffffULL, 0xfffffffff8000000ULL, 0x00000000ffffffffULL,
+    0xfffffffff8000000ULL, 0x000000007fffffffULL, 0xfffffffff8000000ULL, 0x000000007fffffffULL,
+    0xfffffffff8000000ULL, 0x000000001fffffffULL, 0xfffffffff8000000ULL, 0x000000001fffffffULL,
+    0xfffffffff8000000ULL, 0x0000000007ffffffULL, 0xfffffffff8000000ULL, 0x0000000007ffffffULL,
+    0xfffffffff8000000ULL, 0x0000000007ffffffULL, 0xfffffffff8000000ULL, 0x0000000007ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000007ffffffULL, 0xfffffffff0000000ULL, 0x0000000007ffffffULL,
+    0xfffffffff0000000ULL, 0x0000000007ffffffULL, 0xfffffffff8000000ULL, 0x0000000001ffffffULL,
+    0xffffffffe0000000ULL, 0x0000000003ffffffULL, 0xffffffffa0000000ULL, 0x0000000003ffffffULL,
+    0xffffffffc0000000ULL, 0x0000000003ffffffULL, 0xffffffffc0000000ULL, 0x0000000003ffffffULL,
+    0xfffffffe00000000ULL, 0x0000000003ffffffULL, 0xffffffff00000000ULL, 0x0000000003ffffffULL,
+    0xffffffff00000000ULL, 0x0000000003ffffffULL, 0xfffffffe00000000ULL, 0x0000000003ffffffULL,
+    0xfffffffc00000000ULL, 0x0000000003ffffffULL, 0xfffffffe00000000ULL, 0x0000000003ffffffULL,
+    0xfffffffc00000000ULL, 0x0000000003ffffffULL, 0xfffffffc00000000ULL, 0x0000000001ffffffULL,
+    0xfffffffc00000000ULL, 0x0000000001ffffffULL, 0xfffffff000000000ULL, 0x00000000017fffffULL,
+    0xfffffff800000000ULL, 0x00000000007fffffULL, 0xfffffff800000000ULL, 0x00000000007dffffULL,
+    0xfffffff800000000ULL, 0x00000000000003ffULL, 0xffffffe000000000ULL, 0x00000000000003ffULL,
+    0xfffffff000000000ULL, 0x00000000000003ffULL, 0xfffffff000000000ULL, 0x00000000000003ffULL,
+    0xfffffff000000000ULL, 0x00000000000003ffULL, 0xffffffe000000000ULL, 0x00000000000003ffULL,
+    0xfffffff800000000ULL, 0x00000000000007ffULL, 0xfffffff800000000ULL, 0x00000000000007ffULL,
+    0xfffffff000000000ULL, 0x00000000000007ffULL, 0xfffffffc00000000ULL, 0x00000000000007ffULL,
+    0xfffffffc00000000ULL, 0x0000000000000fffULL, 0xffffffff00000000ULL, 0x0000000000000fffULL,
+    0xfffffffe00000000ULL, 0x0000000000001fffULL, 0xffffffff80000000ULL, 0x0000000000002fffULL,
+    0xffffffff00000000ULL, 0x0000000000002fffULL, 0xffffffffc0000000ULL, 0x0000000000003fffULL,
+    0xffffffffc0000000ULL, 0x0000000000003fffULL, 0xffffffff80000000ULL, 0x0000000000003fffULL,
+    0xffffffffe0000000ULL, 0x0000000000003fffULL, 0xffffffffe0000000ULL, 0x000000000001ffffULL,
+    0xffffffffe0000000ULL, 0x000000000005ffffULL, 0xffffffffe0000000ULL, 0x00000000001bffffULL,
+    0xff3fffffe0000000ULL, 0x00000000003fffffULL, 0xfe1fffffe0000000ULL, 0x00000000003fffffULL,
+    0xff3fffffe0000000ULL, 0x00000000007fffffULL, 0xfe3fffffe0000000ULL, 0x0000000001ffffffULL,
+    0xfe0fffffe0000000ULL, 0x0000000001ffffffULL, 0xfe0fffffe0000000ULL, 0x0000000007ffffffULL,
+    0xfe0fffffe0000000ULL, 0x000000000fffffffULL, 0xf80fffffe0000000ULL, 0x000000001fffffffULL,
+    0xf80fffff80000000ULL, 0x000000003fffffffULL, 0xf81fffff80000000ULL, 0x000000001fffffffULL,
+    0xf81fffff80000000ULL, 0x00000000ffffffffULL, 0xe01fffff80000000ULL, 0x000000007fffffffULL,
+    0x401fffff80000000ULL, 0x00000001ffffffffULL, 0x001fffff80000000ULL, 0x0000000dffffffffULL,
+    0x001fffff80000000ULL, 0x0000000bfffffffeULL, 0x001fffff80000000ULL, 0x0000003ffffffff8ULL,
+    0x001fffff80000000ULL, 0x0000007fffffffe0ULL, 0x001fffff80000000ULL, 0x000000ffffffffc0ULL,
+    0x001fffff80000000ULL, 0x000000ffffffffc0ULL, 0x001fffff80000000ULL, 0x000007ffffffff00ULL,
+    0x001fffff80000000ULL, 0x000037fffffffe00ULL, 0x001fffff80000000ULL, 0x0000bffffffff800ULL,
+    0x001fffff80000000ULL, 0x0003fffffffff800ULL, 0x001fffff80000000ULL, 0x000ffffffffff000ULL,
+    0x001fffff80000000ULL, 0x000fffffffffc000ULL, 0x001fffff80000000ULL, 0x003fffffffffc000ULL,
+    0x001fffff80000000ULL, 0x003fffffffff0000ULL, 0x001fffff80000000ULL, 0x00ffffffffff0000ULL,
+    0x001fffff80000000ULL, 0x01fffffffffe0000ULL, 0x001fffff80000000ULL, 0x01fffffffffe0000ULL,
+    0x001fffff80000000ULL, 0x01fffffffffc0000ULL, 0x001ffffff0000000ULL, 0x01fffffffff00000ULL,
+    0x001ffffff0000000ULL, 0x01fffffffff00000ULL, 0x001ffffff0000000ULL, 0x003ffffffff00000ULL,
+    0x003ffffff0000000ULL, 0x007ffffffff00000ULL, 0x007fffffe0000000ULL, 0x007ffffffff00000ULL,
+    0x007ffffff0000000ULL, 0x003fffffffd00000ULL, 0x007ffffff8000000ULL, 0x001fffffff800000ULL,
+    0x007ffffffc000000ULL, 0x001fffffffc00000ULL, 0x000ffffff8000000ULL, 0x000fffffffc00000ULL,
+    0x001ffffff8000000ULL, 0x0007ffffffc00000ULL, 0x001ffffffe000000ULL, 0x000fffffffc00000ULL,
+    0x007fffffff000000ULL, 0x0003ffffff000000ULL, 0x005fffffff000000ULL, 0x0007ffffff800000ULL,
+    0x007ffffffe000000ULL, 0x0007ffffff800000ULL, 0x007fffffff800000ULL, 0x0003ffffff800000ULL,
+    0x005fffffff800000ULL, 0x0003ffffff800000ULL, 0x003fffffffe00000ULL, 0x0000ffffff800000ULL,
+    0x000fffffffe00000ULL, 0x00017fffff800000ULL, 0x001ffffffff80000ULL, 0x0000ffffff800000ULL,
+    0x001ffffffffa0000ULL, 0x0000ffffff000000ULL, 0x000ffffffffffe00ULL, 0x00007fffffc00000ULL,
+    0x000ffffffffffe00ULL, 0x00007fffffe00000ULL, 0x000fffffffffffe0ULL, 0x00007ffffff00000ULL,
+    0x000fffffffffffe0ULL, 0x00003ffffff00000ULL, 0x000ffffffffffff0ULL, 0x00003ffffffe0000ULL,
+    0x000ffffffffffff0ULL, 0x00003ffffffe0000ULL, 0x000ffffffffffffcULL, 0x00000fffffff0000ULL,
+    0x000fffffffffffffULL, 0x00001fffffff0000ULL, 0x000fffffffffffffULL, 0x000007ffffff0000ULL,
+    0x000fffffffffffffULL, 0x00000fffffff0000ULL, 0x000fffffffffffffULL, 0x000003ffffff0000ULL,
+    0x000fffffffffffffULL, 0x000003ffffff0000ULL, 0x000fffffffffffffULL, 0x000003ffffff0000ULL,
+    0x000fffffffffffffULL, 0x0000017fffff0000ULL, 0x000fffffffffffffULL, 0x0000003ffffe0000ULL,
+    0x000fffffffffffffULL, 0x0000003ffffe0000ULL, 0x000ffffffffffffdULL, 0x0000001ffffa0000ULL,
+    0x000700000fd8ffe4ULL, 0x0000000ffffc0000ULL, 0x00001c0000000000ULL, 0x0000000000000000ULL,
+};
+
+// img/jumping.png, 234x260
+static const uint64_t jumping_right_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x000017ff00000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00001fff40000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00001fffc0000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x000ffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x000bfffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x01fffffffef00000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x05ffffffffc00000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x17ffffffffe00000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7ffffffffff78000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7fffffffffff0000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7ffffffffffe0000ULL, 0x0000000000000001ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffff6000ULL, 0x0000000000000002ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffe000ULL, 0x0000000000000007ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffe000ULL, 0x000000000000000fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffe800ULL, 0x000000000000001fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x000000000000000fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff000ULL, 0x000000000000005fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffc00ULL, 0x000000000000007fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x00000000000000ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x00000000000001ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffd00ULL, 0x00000000000002ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff00ULL, 0x00000000000005ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffe00ULL, 0x00000000000007ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffe80ULL, 0x00000000000003ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000000fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000000fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffffffffff80ULL, 0x0000000000002fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffc00ULL, 0x0000000000000fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffe00ULL, 0x0000000000001f1fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffe00ULL, 0x0000000000001f3fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffe00ULL, 0x0000000000000f3fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffffa00ULL, 0x0000000000000f3fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x0000000000000e3fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x000000000000031fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x000000000000030fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x000000000000030bULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff800ULL, 0x0000000000000003ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffffffff000ULL, 0x0000000000000002ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7fffffffffffc000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xff80000000000000ULL, 0x7fffffffffffc03fULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xff80000000000000ULL, 0x7fffffffffff003fULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffb0000000000000ULL, 0x7fffffffffff801fULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffc000000000000ULL, 0x7fffffffffffc03fULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfff4000000000000ULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffc0000007fe000ULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffff8000007fe000ULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffff8000ff7fef00ULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffff8000ffffffc0ULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x8000000000000000ULL, 0xffff007fffffffffULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0x4000000000000000ULL, 0xffff801fffffffe0ULL, 0xffffffffffffffffULL, 0x0000000000000000ULL,
+    0x8800000000000000ULL, 0xffffc03fffffffffULL, 0x3fffffffffffffffULL, 0x0000000000000000ULL,
+    0xd800000000000000ULL, 0xffffef7fffffffffULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0xfff8000000000000ULL, 0xffffffffffffffffULL, 0x7fffffffffffffffULL, 0x0000000000000000ULL,
+    0xfff8000000000000ULL, 0xffffffffffffffffULL, 0x0fffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffe000000000000ULL, 0xffffffffffffffffULL, 0x17ffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffe000000000000ULL, 0xffffffffffffffffULL, 0x03ffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffc000000000000ULL, 0xffffffffffffffffULL, 0x0dffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffee00000000000ULL, 0xffffffffffffffffULL, 0x02ffffffffffffffULL, 0x0000000000000000ULL,
+    0xffffe00000000000ULL, 0xffffffffffffffffULL, 0x00ffffffffffffffULL, 0x0000000000000000ULL,
+    0xffffe80000000000ULL, 0xffffffffffffffffULL, 0x00dfffffffffffffULL, 0x00000000ffc00000ULL,
+    0xffffff0000000000ULL, 0xffffffffffffffffULL, 0x003fffffffffffffULL, 0x00000000ffe00000ULL,
+    0xffffffe000000000ULL, 0xffffffffffffffffULL, 0x001fffffffffffffULL, 0x000000007ff00000ULL,
+    0xfffffff800000000ULL, 0xffffffffffffffffULL, 0x00000fffffffffffULL, 0x00000002fff80000ULL,
+    0xfffffffe00000000ULL, 0xffffffffffffffffULL, 0x00000fffffffffffULL, 0x00000001fffe0000ULL,
+    0xfffffffe00000000ULL, 0xffffffffffffffffULL, 0x00003fffffffffffULL, 0x00000003fff80000ULL,
+    0xfffffffe80000000ULL, 0xffffffffffffffffULL, 0x00003fffffffffffULL, 0x0000000ffffc0000ULL,
+    0xffffffff80000000ULL, 0xffffffffffffffffULL, 0x00007fffffffffffULL, 0x00000007fffe3000ULL,
+    0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0x0000ffffffffffffULL, 0x0000002ffffff000ULL,
+    0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0x00007fffffffffffULL, 0x0000005ffffff000ULL,
+    0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0x0001ffffffffffffULL, 0x0000007ffffff000ULL,
+    0xffffffffe0000000ULL, 0xfffffffffdffffffULL, 0x0000ffffffffffffULL, 0x0000007ffffff000ULL,
+    0xffffffffe0000000ULL, 0xfffffffff8003fffULL, 0x0005ffffffffffffULL, 0x0000007ffffff000ULL,
+    0xffffffffe0000000ULL, 0xfffffffffc001fffULL, 0x0007ffffffffffffULL, 0x0000007ffffff000ULL,
+    0xffffffffe0000000ULL, 0xfffffffffc001fffULL, 0x0003ffffffffffffULL, 0x000000fffffff000ULL,
+    0xbfffffff00000000ULL, 0xffffff82000003ffULL, 0x000bffffffffffffULL, 0x000000fffffff000ULL,
+    0x37ffffff80000000ULL, 0xffffff8200000000ULL, 0x000fffffffffffffULL, 0x000000fffffff800ULL,
+    0x03fffffe00000000ULL, 0xfffff88000000000ULL, 0x001fffffffffffffULL, 0x000000ffffffe000ULL,
+    0x07ffffff00000000ULL, 0xfffff00000000000ULL, 0x005fffffffffffffULL, 0x000000fffffff000ULL,
+    0x07fffffe00000000ULL, 0xffffe80000000000ULL, 0x01bfffffffffffffULL, 0x000000ffffffe000ULL,
+    0x07fffffe00000000ULL, 0xfffff80000000000ULL, 0x01ffffffffffffffULL, 0x000000ffffffe000ULL,
+    0x07fffff000000000ULL, 0xfffffc0000000000ULL, 0x03ffffffffffffffULL, 0x0000007ffffff800ULL,
+    0x07fffff800000000ULL, 0xfffffc0000000000ULL, 0x0fffffffffffffffULL, 0x000003fffffffc00ULL,
+    0x03fffff000000000ULL, 0xfffffc0000000000ULL, 0x17ffffffffffffffULL, 0x000003fffffffc00ULL,
+    0x03fffff000000000ULL, 0xfffffe0000000000ULL, 0x0fffffffffffffffULL, 0x000001fffffff800ULL,
+    0x00bfff8000000000ULL, 0xfffffe0000000000ULL, 0x5fffffffffffffffULL, 0x000002fffffffc08ULL,
+    0x001fff4000000000ULL, 0xfffffe0000000000ULL, 0xffffffffffffffffULL, 0x000001fffffffffbULL,
+    0x003fff0000000000ULL, 0xfffffc0000000000ULL, 0xffffffffffffffffULL, 0x000001ffffffffffULL,
+    0x000ffe0000000000ULL, 0xffffff8000000000ULL, 0xffffffffffffffffULL, 0x0000003fffffffffULL,
+    0x0008030000000000ULL, 0xffffff8000000000ULL, 0xffffffffffffffffULL, 0x0000005fffffffffULL,
+    0x0000000000000000ULL, 0xffffff8000000000ULL, 0xffffffffffffffffULL, 0x0000006fffffffffULL,
+    0x0000000000000000ULL, 0xffffff8000000000ULL, 0xffffffffffffffffULL, 0x0000000fffffffffULL,
+    0x0000000000000000ULL, 0xffffffc000000000ULL, 0xffffffffffffffffULL, 0x0000000bffffffffULL,
+    0x0000000000000000ULL, 0xffffffc000000000ULL, 0xffffffffffffffffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xffffffc000000000ULL, 0xffffffffffffffffULL, 0x00000000ffffffffULL,
+    0x0000000000000000ULL, 0xffffffe000000000ULL, 0xffffffffffffffffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xfffffff000000000ULL, 0xfffffffbffffffffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xfffffff000000000ULL, 0xfffffffdffffffffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xfffffff000000000ULL, 0xfffffec3ffffffffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xfffffff800000000ULL, 0xfffffe03ffffffffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xfffffff000000000ULL, 0xfffffe03ffffffffULL, 0x000000009fffffffULL,
+    0x0000000000000000ULL, 0xfffffff000000000ULL, 0xfffff803ffffffffULL, 0x000000001fffffffULL,
+    0x0000000000000000ULL, 0xfffffffc00000000ULL, 0xfffff800ffffffffULL, 0x000000001effffffULL,
+    0x0000000000000000ULL, 0xfffffff800000000ULL, 0xffffa000ffffffffULL, 0x0000000000bfffffULL,
+    0x0000000000000000ULL, 0xfffffffe00000000ULL, 0xffff80007fffffffULL, 0x00000000007fffffULL,
+    0x0000000000000000ULL, 0xffffffff00000000ULL, 0xfffe00001fffffffULL, 0x00000000001fffffULL,
+    0x0000000000000000ULL, 0xfffffffe00000000ULL, 0xfffa00001fffffffULL, 0x000000000005ffffULL,
+    0x0000000000000000ULL, 0xffffffff00000000ULL, 0xfff000003fffffffULL, 0x000000000000ffffULL,
+    0x0000000000000000ULL, 0xffffffffc0000000ULL, 0xffc800002fffffffULL, 0x000000000001ffffULL,
+    0x0000000000000000ULL, 0xffffffff80000000ULL, 0xff80000007ffffffULL, 0x0000000000003fffULL,
+    0x0000000000000000ULL, 0xffffffffa0000000ULL, 0xffc000000fffffffULL, 0x0000000000000fffULL,
+    0x0000000000000000ULL, 0xffffffffe0000000ULL, 0xff0000000fffffffULL, 0x0000000000000cffULL,
+    0x0000000000000000ULL, 0xfffffffff8000000ULL, 0xfe0000000fffffffULL, 0x00000000000000bfULL,
+    0x0000000000000000ULL, 0xfffffffff8000000ULL, 0xf00000000fffffffULL, 0x000000000000005fULL,
+    0x0000000000000000ULL, 0xfffffffff8000000ULL, 0xf00000000fffffffULL, 0x000000000000001fULL,
+    0x0000000000000000ULL, 0xfffffffff0000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffffe000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xfffffffff8000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x000007c000000000ULL, 0xfffffffff8000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x000007c000000000ULL, 0xfffffffff0000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x000007d800000000ULL, 0xffffffffe0000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x00001ff800000000ULL, 0xffffffff80000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x00001ffe00000000ULL, 0xffffffff40000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x00005ffe00000000ULL, 0xffffffff80000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x00003ffe80000000ULL, 0xfffffffe80000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL,
+    0x00007fffe0000000ULL, 0xfffffffe00000000ULL, 0x0000000007ffffffULL, 0x0000000000000000ULL,
+    0x0000ffffa0000000ULL, 0xfffffffe00000000ULL, 0x0000000007ffffffULL, 0x0000000000000000ULL,
+    0x0003ffffd8000000ULL, 0xfffffffe00000000ULL, 0x0000000007ffffffULL, 0x0000000000000000ULL,
+    0x0007fffff4000000ULL, 0xfffffffe00000000ULL, 0x0000000007ffffffULL, 0x0000000000000000ULL,
+    0x0007fffffa000000ULL, 0xfffffffe00000000ULL, 0x0000000007ffeeffULL, 0x0000000000000000ULL,
+    0x000fffffff000000ULL, 0xfffffffe00000000ULL, 0x0000000007ffe07fULL, 0x0000000000000000ULL,
+    0x0007fffffe000000ULL, 0xfffffffe00000000ULL, 0x0000000004fec0ffULL, 0x0000000000000000ULL,
+    0x002fffffff400000ULL, 0xfffffffe00000000ULL, 0x0000000001fa007fULL, 0x0000000000000000ULL,
+    0x01ffffffffe00000ULL, 0xfffffffe80000000ULL, 0x0000000001fe06ffULL, 0x0000000000000000ULL,
+    0x03ffffffffd00000ULL, 0xfffffffe80000000ULL, 0x0000000001e007ffULL, 0x0000000000000000ULL,
+    0x00ffffffffec0000ULL, 0xfffffffe80000000ULL, 0x0000000001e047ffULL, 0x0000000000000000ULL,
+    0x00fffffffffc0000ULL, 0xffffffff00000000ULL, 0x0000000001e17fffULL, 0x0000000000000000ULL,
+    0x03ffffffffff0000ULL, 0xffffffff00000000ULL, 0x0000000001afffffULL, 0x0000000000000000ULL,
+    0x01ffffffffff0000ULL, 0xffffffff00000000ULL, 0x00000000007fffffULL, 0x0000000000000000ULL,
+    0x7bffffffffffc000ULL, 0xffffffff00000000ULL, 0x00000000003fffffULL, 0x0000000000000000ULL,
+    0xffffffffffffe000ULL, 0xffffffff80000001ULL, 0x0000000001ffffffULL, 0x0000000000000000ULL,
+    0xffffffffffffc000ULL, 0xffffffff80000006ULL, 0x0000000001ffffffULL, 0x0000000000000000ULL,
+    0xffffffffffffe800ULL, 0xffffffff00000017ULL, 0x0000000003ffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffff400ULL, 0xffffffffa000009fULL, 0x000000002fffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffff800ULL, 0xffffffffa00000bfULL, 0x00000000ffffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xffffffffd0000cffULL, 0x00000000ffffffffULL, 0x0000000000000000ULL,
+    0xffffffffffffff00ULL, 0xffffffffe8000fffULL, 0x0000000fffffffffULL, 0x0000000000000000ULL,
+    0xffffffffffffff00ULL, 0xffffffffe8005fffULL, 0x0000007fffffffffULL, 0x0000000000000000ULL,
+    0xffffffffffffffc0ULL, 0xfffffffff4017fffULL, 0x0000007fffffffffULL, 0x0000000000000000ULL,
+    0xffffffffffffff80ULL, 0xfffffffffc05ffffULL, 0x000001ffffffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffffff0ULL, 0xfffffffffe1fffffULL, 0x000007ffffffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffffff0ULL, 0xfffffffffeffffffULL, 0x000007ffffffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffffff8ULL, 0xffffffffffffffffULL, 0x00001fffffffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffffff8ULL, 0xffffffffffffffffULL, 0x00001fffffffffffULL, 0x0000000000000000ULL,
+    0xfffffffffffffffcULL, 0xffffffffffffffffULL, 0x00001fffffffffffULL, 0x0000000000000000ULL,
+    0xffffffdbfffffffcULL, 0xf7ffffffffffffffULL, 0x00003fffffffffffULL, 0x0000000000000000ULL,
+    0xffffffc7dffffffcULL, 0xf07fffffffffffffULL, 0x00001fffffffffffULL, 0x0000000000000000ULL,
+    0xffffffc017fffffcULL, 0x707fffffffffffffULL, 0x00001ffffffffffeULL, 0x0000000000000000ULL,
+    0xfffffe0005fffffcULL, 0x001fffffffffffffULL, 0x00001ffffffffffcULL, 0x0000000000000000ULL,
+    0xffffff0003fffffcULL, 0x000fffffffffffffULL, 0x00001ffffffffffcULL, 0x0000000000000000ULL,
+    0xffff7f00003bfffcULL, 0x0005ffffffffffffULL, 0x00001fffffffffd0ULL, 0x0000000000000000ULL,
+    0xffff00000003ffe0ULL, 0x0001ffffffffffffULL, 0x00001fffffffffe0ULL, 0x0000000000000000ULL,
+    0xfffe00000003bfd0ULL, 0x0001ffffffffffffULL, 0x00001ffffffff600ULL, 0x0000000000000000ULL,
+    0xffe8000000003fe0ULL, 0x00007fffffffffffULL, 0x00003fffffffb800ULL, 0x0000000000000000ULL,
+    0xffa0000000003fc0ULL, 0x00007fffffffffffULL, 0x0000ffffffff8000ULL, 0x0000000000000000ULL,
+    0xff80000000000000ULL, 0x00001fffffffffffULL, 0x0000fffffffd8000ULL, 0x0000000000000000ULL,
+    0xff00000000000000ULL, 0x00000fffffffffffULL, 0x00007fffffe40000ULL, 0x0000000000000000ULL,
+    0xfc00000000000000ULL, 0x000007ffffffffffULL, 0x0001ffffffc00000ULL, 0x0000000000000000ULL,
+    0xe000000000000000ULL, 0x000002ffffffffffULL, 0x0001ffffffa00000ULL, 0x0000000000000000ULL,
+    0xc000000000000000ULL, 0x000000ffffffffffULL, 0x0001ffffff000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000003ffffffffeULL, 0x0003ffffff800000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000001ffffffffeULL, 0x0003ffffff000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000001ffffffff8ULL, 0x0003ffffff000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000bfffffec0ULL, 0x0003ffffff000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x00000001fffffa00ULL, 0x0007ffffff000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x00000000fffff000ULL, 0x0003ffffff000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x00000001fffff000ULL, 0x001ffffffc000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x00000000bfffe000ULL, 0x0007fffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x000000003ffe8000ULL, 0x0007fffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x000000003ffe0000ULL, 0x003ffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000003e60000ULL, 0x003ffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000001f80000ULL, 0x007ffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x003ffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00fffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x007ffffffe000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00fffffffc000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x01fffffffc000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x00fffffffc000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x01fffffffc000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x07fffffffc000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x07fffffff0000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1ffffffff0000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x3fffffffe0000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x1fffffffe0000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffff80000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffff00000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7fffffff80000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffe00000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffff00000000ULL, 0x000000000000001fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffe00000000ULL, 0x000000000000001fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffe00000000ULL, 0x000000000000007fULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffc00000000ULL, 0x00000000000001ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffffc00000000ULL, 0x000000001ff001ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffff000000000ULL, 0x000000000fe805ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffff000000000ULL, 0x000000031ff7fbffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffc000000000ULL, 0x00000003ffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffe000000000ULL, 0x0000000fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffe000000000ULL, 0x0000000fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffffa000000000ULL, 0x0000003fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffff4000000000ULL, 0x0000003fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffec000000000ULL, 0x0000003fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffc0000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffe0000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffe0000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffc0000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffc0000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffc0000000000ULL, 0x0000003fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffffe0000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffff60000000000ULL, 0x0000001fffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffe00000000000ULL, 0x00000003ffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffff00000000000ULL, 0x00000005ffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffff00000000000ULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffff800000000000ULL, 0x00000000ffffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffffc00000000000ULL, 0x000000003fffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffff000000000000ULL, 0x000000000bffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffff800000000000ULL, 0x0000000003ffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffff800000000000ULL, 0x0000000003ffffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffff000000000000ULL, 0x0000000000dfffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffe000000000000ULL, 0x000000000017ffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffe000000000000ULL, 0x000000000003ffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfffe000000000000ULL, 0x000000000007ffffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff8000000000000ULL, 0x0000000000017fffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff0000000000000ULL, 0x000000000000dfffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff0000000000000ULL, 0x00000000000013ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff0000000000000ULL, 0x00000000000003ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff8000000000000ULL, 0x00000000000002ffULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffe0000000000000ULL, 0x00000000000000efULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xfff0000000000000ULL, 0x0000000000000057ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xffe0000000000000ULL, 0x000000000000000cULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xff80000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0xbf80000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x7f80000000000000ULL, 0x0000000000000000ULL,
+};
+
+// img/jumping.png mirrored, 234x260
+static const uint64_t jumping_left_rows[] = {
+    0xa000000000000000ULL, 0x00000000000003ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xe000000000000000ULL, 0x0000000000000bffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xe000000000000000ULL, 0x0000000000000fffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffc0000000000000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xff40000000000000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffe000000000000ULL, 0x00000000003dffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffe800000000000ULL, 0x00000000000fffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffa00000000000ULL, 0x00000000001fffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x0000000007bfffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x0000000003ffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffa0000000000ULL, 0x0000000001ffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffd0000000000ULL, 0x000000001bffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffff8000000000ULL, 0x000000001fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffc000000000ULL, 0x000000001fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffe000000000ULL, 0x000000005fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffc000000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffe800000000ULL, 0x000000003fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffff800000000ULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffc00000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffe00000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffd00000000ULL, 0x00000002ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffe80000000ULL, 0x00000003ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffff80000000ULL, 0x00000001ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffff00000000ULL, 0x00000005ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffc0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffc0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffff0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffd0000000ULL, 0x00000007ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffc0000000ULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffe3e0000000ULL, 0x00000001ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffff3e0000000ULL, 0x00000001ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffff3c0000000ULL, 0x00000001ffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffff3c0000000ULL, 0x000000017fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffff1c0000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffe300000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffc300000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffff4300000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffff0000000000ULL, 0x000000007fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffd0000000000ULL, 0x000000003fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x000000000fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x0007fff00fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x0007fff003ffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x0037ffe007ffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x00fffff00fffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x00bfffffffffffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x00ffffffffffffffULL, 0x000000001ff80000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x07ffffffffffffffULL, 0x000000001ff80000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x07ffffffffffffffULL, 0x00000003dffbfc00ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x07ffffffffffffffULL, 0x0000000ffffffc00ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x03ffffffffffffffULL, 0x000007fffffffff8ULL, 0x0000000000000000ULL,
+    0xfffffc0000000000ULL, 0x07ffffffffffffffULL, 0x0000081fffffffe0ULL, 0x0000000000000000ULL,
+    0xfffff00000000000ULL, 0x0fffffffffffffffULL, 0x000047fffffffff0ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0xdfffffffffffffffULL, 0x00006ffffffffffbULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0xffffffffffffffffULL, 0x007fffffffffffffULL, 0x0000000000000000ULL,
+    0xffffc00000000000ULL, 0xffffffffffffffffULL, 0x007fffffffffffffULL, 0x0000000000000000ULL,
+    0xffffa00000000000ULL, 0xffffffffffffffffULL, 0x01ffffffffffffffULL, 0x0000000000000000ULL,
+    0xffff000000000000ULL, 0xffffffffffffffffULL, 0x01ffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffec00000000000ULL, 0xffffffffffffffffULL, 0x00ffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffd000000000000ULL, 0xffffffffffffffffULL, 0x1dffffffffffffffULL, 0x0000000000000000ULL,
+    0xfffc000000000000ULL, 0xffffffffffffffffULL, 0x1fffffffffffffffULL, 0x0000000000000000ULL,
+    0xffec0000000ffc00ULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL, 0x0000000000000000ULL,
+    0xfff00000001ffc00ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000000000000003ULL,
+    0xffe00000003ff800ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x000000000000001fULL,
+    0xc0000000007ffd00ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x000000000000007fULL,
+    0xc000000001fffe00ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000001ffULL,
+    0xf0000000007fff00ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000001ffULL,
+    0xf000000000ffffc0ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000005ffULL,
+    0xf800000031ffff80ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x00000000000007ffULL,
+    0xfc0000003fffffd0ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000000000001fffULL,
+    0xf80000003fffffe8ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000000000001fffULL,
+    0xfe0000003ffffff8ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000000000001fffULL,
+    0xfc0000003ffffff8ULL, 0xffffffffffffffffULL, 0xfffffffffffeffffULL, 0x0000000000001fffULL,
+    0xfe8000003ffffff8ULL, 0xffffffffffffffffULL, 0xfffffffff0007fffULL, 0x0000000000001fffULL,
+    0xff8000003ffffff8ULL, 0xffffffffffffffffULL, 0xffffffffe000ffffULL, 0x0000000000001fffULL,
+    0xff0000003ffffffcULL, 0xffffffffffffffffULL, 0xffffffffe000ffffULL, 0x0000000000001fffULL,
+    0xff4000003ffffffcULL, 0xffffffffffffffffULL, 0xfffff7ff00000107ULL, 0x00000000000003ffULL,
+    0xffc000007ffffffcULL, 0xffffffffffffffffULL, 0xffffb00000000107ULL, 0x00000000000007ffULL,
+    0xffe000001ffffffcULL, 0x7fffffffffffffffULL, 0xffff000000000004ULL, 0x00000000000001ffULL,
+    0xffe800003ffffffcULL, 0x3fffffffffffffffULL, 0xffff800000000000ULL, 0x00000000000003ffULL,
+    0xfff600001ffffffcULL, 0x5fffffffffffffffULL, 0xffff800000000000ULL, 0x00000000000001ffULL,
+    0xfffe00001ffffffcULL, 0x7fffffffffffffffULL, 0xffff800000000000ULL, 0x00000000000001ffULL,
+    0xffff00007ffffff8ULL, 0xffffffffffffffffULL, 0xffff800000000000ULL, 0x000000000000003fULL,
+    0xffffc000ffffffffULL, 0xffffffffffffffffULL, 0xffff800000000000ULL, 0x000000000000007fULL,
+    0xffffa000ffffffffULL, 0xffffffffffffffffULL, 0xffff000000000000ULL, 0x000000000000003fULL,
+    0xffffc0007ffffffeULL, 0xffffffffffffffffULL, 0xffff000000000001ULL, 0x000000000000003fULL,
+    0xffffe840fffffffdULL, 0xffffffffffffffffULL, 0xfff4000000000001ULL, 0x0000000000000007ULL,
+    0xffffff7ffffffffeULL, 0xffffffffffffffffULL, 0xffe0000000000001ULL, 0x000000000000000bULL,
+    0xfffffffffffffffeULL, 0xffffffffffffffffULL, 0xfff0000000000000ULL, 0x0000000000000003ULL,
+    0xfffffffffffffff0ULL, 0xffffffffffffffffULL, 0xffc0000000000007ULL, 0x0000000000000001ULL,
+    0xffffffffffffffe8ULL, 0xffffffffffffffffULL, 0x0040000000000007ULL, 0x0000000000000003ULL,
+    0xffffffffffffffd8ULL, 0xffffffffffffffffULL, 0x0000000000000007ULL, 0x0000000000000000ULL,
+    0xffffffffffffffc0ULL, 0xffffffffffffffffULL, 0x0000000000000007ULL, 0x0000000000000000ULL,
+    0xffffffffffffff40ULL, 0xffffffffffffffffULL, 0x000000000000000fULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xffffffffffffffffULL, 0x000000000000000fULL, 0x0000000000000000ULL,
+    0xfffffffffffffc00ULL, 0xffffffffffffffffULL, 0x000000000000000fULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xffffffffffffffffULL, 0x000000000000001fULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xffffffffffffff7fULL, 0x000000000000003fULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xfffffffffffffeffULL, 0x000000000000003fULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xffffffffffffff0dULL, 0x000000000000003fULL, 0x0000000000000000ULL,
+    0xfffffffffffffe00ULL, 0xffffffffffffff01ULL, 0x000000000000007fULL, 0x0000000000000000ULL,
+    0xffffffffffffe400ULL, 0xffffffffffffff01ULL, 0x000000000000003fULL, 0x0000000000000000ULL,
+    0x7fffffffffffe000ULL, 0xffffffffffffff00ULL, 0x000000000000003fULL, 0x0000000000000000ULL,
+    0x7ffffffffffde000ULL, 0xfffffffffffffc00ULL, 0x00000000000000ffULL, 0x0000000000000000ULL,
+    0x17fffffffff40000ULL, 0xfffffffffffffc00ULL, 0x000000000000007fULL, 0x0000000000000000ULL,
+    0x07fffffffff80000ULL, 0xfffffffffffff800ULL, 0x00000000000001ffULL, 0x0000000000000000ULL,
+    0x01ffffffffe00000ULL, 0xffffffffffffe000ULL, 0x00000000000003ffULL, 0x0000000000000000ULL,
+    0x017ffffffe800000ULL, 0xffffffffffffe000ULL, 0x00000000000001ffULL, 0x0000000000000000ULL,
+    0x003ffffffc000000ULL, 0xfffffffffffff000ULL, 0x00000000000003ffULL, 0x0000000000000000ULL,
+    0x004ffffffe000000ULL, 0xffffffffffffd000ULL, 0x0000000000000fffULL, 0x0000000000000000ULL,
+    0x0007fffff0000000ULL, 0xffffffffffff8000ULL, 0x00000000000007ffULL, 0x0000000000000000ULL,
+    0x000fffffc0000000ULL, 0xffffffffffffc000ULL, 0x00000000000017ffULL, 0x0000000000000000ULL,
+    0x0003fffcc0000000ULL, 0xffffffffffffc000ULL, 0x0000000000001fffULL, 0x0000000000000000ULL,
+    0x0001fff400000000ULL, 0xffffffffffffc000ULL, 0x0000000000007fffULL, 0x0000000000000000ULL,
+    0x00003fe800000000ULL, 0xffffffffffffc000ULL, 0x0000000000007fffULL, 0x0000000000000000ULL,
+    0x00003fe000000000ULL, 0xffffffffffffc000ULL, 0x0000000000007fffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x0000000000003fffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x0000000000007fffULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x8000000000007fffULL, 0x000000000000000fULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x8000000000003fffULL, 0x000000000000000fULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0x8000000000001fffULL, 0x000000000000006fULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0xe0000000000007ffULL, 0x000000000000007fULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0xe000000000000bffULL, 0x00000000000001ffULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0xe8000000000007ffULL, 0x00000000000001ffULL,
+    0x0000000000000000ULL, 0xffffffffffffc000ULL, 0xf0000000000005ffULL, 0x00000000000005ffULL,
+    0x0000000000000000ULL, 0xffffffffffff8000ULL, 0xf8000000000001ffULL, 0x0000000000001fffULL,
+    0x0000000000000000ULL, 0xffffffffffff8000ULL, 0xfc000000000001ffULL, 0x00000000000017ffULL,
+    0x0000000000000000ULL, 0xffffffffffff8000ULL, 0xff000000000001ffULL, 0x0000000000006fffULL,
+    0x0000000000000000ULL, 0xffffffffffff8000ULL, 0xff800000000001ffULL, 0x000000000000bfffULL,
+    0x0000000000000000ULL, 0xfffffffddfff8000ULL, 0xff800000000001ffULL, 0x0000000000017fffULL,
+    0x0000000000000000ULL, 0xfffffff81fff8000ULL, 0xffc00000000001ffULL, 0x000000000003ffffULL,
+    0x0000000000000000ULL, 0xfffffffc0dfc8000ULL, 0xff800000000001ffULL, 0x000000000001ffffULL,
+    0x0000000000000000ULL, 0xfffffff8017e0000ULL, 0xffd00000000001ffULL, 0x00000000000bffffULL,
+    0x0000000000000000ULL, 0xfffffffd81fe0000ULL, 0xfffe0000000005ffULL, 0x00000000001fffffULL,
+    0x0000000000000000ULL, 0xffffffff801e0000ULL, 0xffff0000000005ffULL, 0x00000000002fffffULL,
+    0x0000000000000000ULL, 0xffffffff881e0000ULL, 0xfffc0000000005ffULL, 0x0000000000dfffffULL,
+    0x0000000000000000ULL, 0xfffffffffa1e0000ULL, 0xfffc0000000003ffULL, 0x0000000000ffffffULL,
+    0x0000000000000000ULL, 0xffffffffffd60000ULL, 0xffff0000000003ffULL, 0x0000000003ffffffULL,
+    0x0000000000000000ULL, 0xfffffffffff80000ULL, 0xfffe0000000003ffULL, 0x0000000003ffffffULL,
+    0x0000000000000000ULL, 0xfffffffffff00000ULL, 0xffff7800000003ffULL, 0x000000000fffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffe0000ULL, 0xfffffe00000007ffULL, 0x000000001fffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffe0000ULL, 0xfffffd80000007ffULL, 0x000000000fffffffULL,
+    0x0000000000000000ULL, 0xffffffffffff0000ULL, 0xffffffa0000003ffULL, 0x000000005fffffffULL,
+    0x0000000000000000ULL, 0xffffffffffffd000ULL, 0xffffffe4000017ffULL, 0x00000000bfffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffffc00ULL, 0xfffffff4000017ffULL, 0x000000007fffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffffc00ULL, 0xfffffffcc0002fffULL, 0x00000001ffffffffULL,
+    0x0000000000000000ULL, 0xffffffffffffffc0ULL, 0xffffffffc0005fffULL, 0x00000003ffffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffffff8ULL, 0xffffffffe8005fffULL, 0x00000003ffffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffffff8ULL, 0xfffffffffa00bfffULL, 0x0000000fffffffffULL,
+    0x0000000000000000ULL, 0xfffffffffffffffeULL, 0xfffffffffe80ffffULL, 0x00000007ffffffffULL,
+    0x8000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffe1ffffULL, 0x0000003fffffffffULL,
+    0x8000000000000000ULL, 0xffffffffffffffffULL, 0xfffffffffffdffffULL, 0x0000003fffffffffULL,
+    0xe000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000007fffffffffULL,
+    0xe000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x0000007fffffffffULL,
+    0xe000000000000000ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x000000ffffffffffULL,
+    0xf000000000000000ULL, 0xffffbfffffffffffULL, 0xffffffffffffffffULL, 0x000000ffffffff6fULL,
+    0xe000000000000000ULL, 0xfff83fffffffffffULL, 0xffffffffffffffffULL, 0x000000ffffffef8fULL,
+    0xe000000000000000ULL, 0xfff839ffffffffffULL, 0xffffffffffffffffULL, 0x000000ffffffa00fULL,
+    0xe000000000000000ULL, 0xffe000ffffffffffULL, 0xffffffffffffffffULL, 0x000000fffffe8001ULL,
+    0xe000000000000000ULL, 0xffc000ffffffffffULL, 0xffffffffffffffffULL, 0x000000ffffff0003ULL,
+    0xe000000000000000ULL, 0xfe80002fffffffffULL, 0xfbffffffffffffffULL, 0x000000ffff700003ULL,
+    0xe000000000000000ULL, 0xfe00001fffffffffULL, 0x03ffffffffffffffULL, 0x0000001fff000000ULL,
+    0xe000000000000000ULL, 0xfe000001bfffffffULL, 0x01ffffffffffffffULL, 0x0000002ff7000000ULL,
+    0xf000000000000000ULL, 0xf800000077ffffffULL, 0x005fffffffffffffULL, 0x0000001ff0000000ULL,
+    0xfc00000000000000ULL, 0xf800000007ffffffULL, 0x0017ffffffffffffULL, 0x0000000ff0000000ULL,
+    0xfc00000000000000ULL, 0xe000000006ffffffULL, 0x0007ffffffffffffULL, 0x0000000000000000ULL,
+    0xf800000000000000ULL, 0xc0000000009fffffULL, 0x0003ffffffffffffULL, 0x0000000000000000ULL,
+    0xfe00000000000000ULL, 0x80000000000fffffULL, 0x0000ffffffffffffULL, 0x0000000000000000ULL,
+    0xfe00000000000000ULL, 0x000000000017ffffULL, 0x00001ffffffffffdULL, 0x0000000000000000ULL,
+    0xfe00000000000000ULL, 0x000000000003ffffULL, 0x00000ffffffffffcULL, 0x0000000000000000ULL,
+    0xff00000000000000ULL, 0x000000000007ffffULL, 0x000001fffffffff0ULL, 0x0000000000000000ULL,
+    0xff00000000000000ULL, 0x000000000003ffffULL, 0x000001ffffffffe0ULL, 0x0000000000000000ULL,
+    0xff00000000000000ULL, 0x000000000003ffffULL, 0x0000007fffffffe0ULL, 0x0000000000000000ULL,
+    0xff00000000000000ULL, 0x000000000003ffffULL, 0x0000000dffffff40ULL, 0x0000000000000000ULL,
+    0xff80000000000000ULL, 0x000000000003ffffULL, 0x000000017ffffe00ULL, 0x0000000000000000ULL,
+    0xff00000000000000ULL, 0x000000000003ffffULL, 0x000000003ffffc00ULL, 0x0000000000000000ULL,
+    0xffe0000000000000ULL, 0x000000000000ffffULL, 0x000000003ffffe00ULL, 0x0000000000000000ULL,
+    0xff80000000000000ULL, 0x000000000001ffffULL, 0x000000001ffff400ULL, 0x0000000000000000ULL,
+    0xff80000000000000ULL, 0x000000000001ffffULL, 0x0000000005fff000ULL, 0x0000000000000000ULL,
+    0xfff0000000000000ULL, 0x000000000001ffffULL, 0x0000000001fff000ULL, 0x0000000000000000ULL,
+    0xfff0000000000000ULL, 0x000000000001ffffULL, 0x00000000019f0000ULL, 0x0000000000000000ULL,
+    0xfff8000000000000ULL, 0x000000000001ffffULL, 0x00000000007e0000ULL, 0x0000000000000000ULL,
+    0xfff0000000000000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffc000000000000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfff8000000000000ULL, 0x000000000001ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffc000000000000ULL, 0x000000000000ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffe000000000000ULL, 0x000000000000ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffc000000000000ULL, 0x000000000000ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffe000000000000ULL, 0x000000000000ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffff800000000000ULL, 0x000000000000ffffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffff800000000000ULL, 0x0000000000003fffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffe00000000000ULL, 0x0000000000003fffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff00000000000ULL, 0x0000000000001fffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffe00000000000ULL, 0x0000000000001fffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffc0000000000ULL, 0x00000000000007ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffc0000000000ULL, 0x00000000000003ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffff80000000000ULL, 0x00000000000007ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffc0000000000ULL, 0x00000000000001ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffe000000000ULL, 0x00000000000003ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffe000000000ULL, 0x00000000000001ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffff800000000ULL, 0x00000000000001ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffe00000000ULL, 0x00000000000000ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffe003fe000ULL, 0x00000000000000ffULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffe805fc000ULL, 0x000000000000003fULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffff7fbfe300ULL, 0x000000000000003fULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffff00ULL, 0x000000000000000fULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffc0ULL, 0x000000000000001fULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffc0ULL, 0x000000000000001fULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffffffffff0ULL, 0x0000000000000017ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffffffffff0ULL, 0x000000000000000bULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffffffffff0ULL, 0x000000000000000dULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffe0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffe0ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffe0ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffe0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffe0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xfffffffffffffff0ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xffffffffffffffe0ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0xbfffffffffffffe0ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x1fffffffffffff00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3ffffffffffffe80ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x3ffffffffffffe00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x07fffffffffffc00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0ffffffffffff000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x03ffffffffff4000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x07ffffffffff0000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x07ffffffffff0000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x03ffffffffec0000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x01ffffffffa00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x01ffffffff000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x01ffffffff800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x007ffffffa000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x003fffffec000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x003fffff20000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x003fffff00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x007ffffd00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x001fffdc00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x003fffa800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x001ffcc000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0007fc0000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0007f40000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0007f80000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+};
+
+// img/crouch2.png, 101x130
+static const uint64_t crouching_right_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0fc0000000000000ULL, 0x0000000000000000ULL, 0x07e0000000000000ULL, 0x0000000000000000ULL,
+    0x07e0000000000000ULL, 0x0000000000000000ULL, 0xfff2000000000000ULL, 0x000000000000001fULL,
+    0xfff6000000000000ULL, 0x000000000000001fULL, 0xffff000000000000ULL, 0x000000000000000fULL,
+    0xffff000000000000ULL, 0x0000000000000007ULL, 0xffffc00000000000ULL, 0x0000000000000007ULL,
+    0xffffe00000000000ULL, 0x000000000000000fULL, 0xffffc00000000000ULL, 0x00000000000003ffULL,
+    0xffffc00000000000ULL, 0x00000000000003ffULL, 0xffffe00000000000ULL, 0x00000000000001ffULL,
+    0xfffff00000000000ULL, 0x000000000000007fULL, 0xfffff00000000000ULL, 0x000000000000007fULL,
+    0xfffff00000000000ULL, 0x00000000000000ffULL, 0xfffff00000000000ULL, 0x00000000000000ffULL,
+    0xfffff00000000000ULL, 0x00000000000000ffULL, 0xffffe00000000000ULL, 0x00000000000001ffULL,
+    0xffffe3f000000000ULL, 0x00000000000001ffULL, 0xffffe7fc00000000ULL, 0x00000000000003ffULL,
+    0xfffffffe00000000ULL, 0x00000000000007ffULL, 0xffffffff00000000ULL, 0x00000000000000ffULL,
+    0xffffffff00000000ULL, 0x00000000000000ffULL, 0xffffffff80000000ULL, 0x00000000000001ffULL,
+    0xffffffffc0000000ULL, 0x00000000000001ffULL, 0xffffffffe0000000ULL, 0x00000000000001ffULL,
+    0xffffffffe0000000ULL, 0x00000000000001ffULL, 0xfffffffff0000000ULL, 0x00000000000001ffULL,
+    0xfffffffff0000000ULL, 0x000000000000001fULL, 0xfffffffff0000000ULL, 0x0000000000000017ULL,
+    0xfffffffff0000000ULL, 0x0000000000000013ULL, 0xfffffffff8000000ULL, 0x0000000000000003ULL,
+    0xfffffffff8000000ULL, 0x0000000000000003ULL, 0xfffffffff8000000ULL, 0x0000000000000003ULL,
+    0xfffffffff8000000ULL, 0x0000000000000001ULL, 0xfffffffff8000000ULL, 0x0000000000000001ULL,
+    0xfffffffff8000000ULL, 0x0000000000000000ULL, 0x7ffffffff0000000ULL, 0x0000000000000000ULL,
+    0x7ffffffff0000000ULL, 0x0000000000000000ULL, 0xfffffffff8000000ULL, 0x0000000000000000ULL,
+    0xfffffffff8000000ULL, 0x0000000000000003ULL, 0xfffffffffc000000ULL, 0x000000000000000fULL,
+    0xfffffffffc000000ULL, 0x000000000000001fULL, 0xfffffffffc000000ULL, 0x000000000000003fULL,
+    0xfffffffffe000000ULL, 0x000000000000007fULL, 0xfffffffffe000000ULL, 0x000000000000007fULL,
+    0xffffffffff000000ULL, 0x00000000000000ffULL, 0xffffffffff000000ULL, 0x00000000000001ffULL,
+    0xffffffffff000000ULL, 0x00000000000003ffULL, 0xffffffffff800000ULL, 0x00000000000003ffULL,
+    0xffffffffff800000ULL, 0x00000000000007ffULL, 0xffffffffff800000ULL, 0x0000000000000fffULL,
+    0xffffffffff800000ULL, 0x0000000000000fffULL, 0xffffffffff800000ULL, 0x0000000000001fffULL,
+    0xffffffffffc00000ULL, 0x0000000000001fffULL, 0xffffffffffe00000ULL, 0x0000000000001fffULL,
+    0xffffffffffe00000ULL, 0x0000000000003fffULL, 0xe7fffffffff00000ULL, 0x0000000000003fffULL,
+    0x87fffffffff00000ULL, 0x0000000000003fffULL, 0x07fffffffff00000ULL, 0x0000000000003fffULL,
+    0x03fffffffff00000ULL, 0x0000000000003ffeULL, 0x00fffffffff00000ULL, 0x0000000000001ffcULL,
+    0x007ffffffff80000ULL, 0x0000000000001ff0ULL, 0x007ffffffff80000ULL, 0x0000000000000ff0ULL,
+    0xe0fffffffff80000ULL, 0x0000000000000fffULL, 0xfffffffffff80000ULL, 0x00000000000003ffULL,
+    0xfffffffffff80000ULL, 0x00000000000003ffULL, 0xfffffffffffc0000ULL, 0x00000000000007ffULL,
+    0xfffffffffffc0000ULL, 0x0000000000000fffULL, 0xfffffffffffc0000ULL, 0x0000000000000fffULL,
+    0xfffffffffffc0000ULL, 0x0000000000000fffULL, 0xfffffffffffc0000ULL, 0x0000000000001fffULL,
+    0xfffffffffffc0000ULL, 0x0000000000001fffULL, 0xfffffffffffc0000ULL, 0x0000000000001fffULL,
+    0xfffffffffffc0000ULL, 0x0000000000001fffULL, 0xfffffffffffc0000ULL, 0x0000000000001fffULL,
+    0xfffffffffffc0000ULL, 0x0000000000001fffULL, 0xfffffffffffc0000ULL, 0x0000000000001fffULL,
+    0xfffffffffffc0000ULL, 0x0000000000000fffULL, 0xfffffffffffc0000ULL, 0x00000000000007ffULL,
+    0xfffffffffffc0000ULL, 0x00000000000003ffULL, 0xfffffffffffc0000ULL, 0x00000000000003ffULL,
+    0xfffffffffffc0000ULL, 0x00000000000000ffULL, 0xffffffffffec0000ULL, 0x000000000000007fULL,
+    0xfff1ffffffcc0000ULL, 0x000000000000001fULL, 0xfff87fffff880000ULL, 0x000000000000000fULL,
+    0xfff87fffff000000ULL, 0x000000000000000fULL, 0xfffc3ffffe000000ULL, 0x0000000000000001ULL,
+    0x7ffe1ffffe000000ULL, 0x0000000000000000ULL, 0x7fff0ffff8000000ULL, 0x0000000000000000ULL,
+    0x3fff07ffe0000000ULL, 0x0000000000000000ULL, 0x3fff83ffe0000000ULL, 0x0000000000000000ULL,
+    0x1fffc1fff0000000ULL, 0x0000000000000000ULL, 0x0fffc1fff0000000ULL, 0x0000000000000000ULL,
+    0x0fffc0fff8000000ULL, 0x0000000000000000ULL, 0x0fffe0fff8000000ULL, 0x0000000000000000ULL,
+    0x0fffe0fff8000000ULL, 0x0000000000000000ULL, 0x3fffe0fff8000000ULL, 0x0000000000000000ULL,
+    0x7fffe1fff8000000ULL, 0x0000000000000000ULL, 0xffffe3fff8000000ULL, 0x0000000000000003ULL,
+    0xffffe7fff8000000ULL, 0x0000000000000007ULL, 0xffffcffffc000000ULL, 0x000000000000000fULL,
+    0xfffffffffc000000ULL, 0x000000000000000fULL, 0xfffffffffcc00000ULL, 0x000000000000001fULL,
+    0xfffffffffc000000ULL, 0x000000000000001fULL, 0xffffffffff800000ULL, 0x00000000000003ffULL,
+    0xffffffffffe80000ULL, 0x0000000000001fffULL, 0xffffffffffee0000ULL, 0x0000000000026effULL,
+    0xfffffffffff00000ULL, 0x0000000000001effULL, 0xffffffffffe00000ULL, 0x0000000000001fffULL,
+    0xffffffffff800000ULL, 0x000000000000003fULL, 0x1ffffffff0000000ULL, 0x0000000000000000ULL,
+    0x0fffffff80000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+};
+
+// img/crouch1.png, 101x130
+static const uint64_t crouching_left_rows[] = {
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x00007e0000000000ULL, 0x0000000000000000ULL, 0x0000fc0000000000ULL, 0x0000000000000000ULL,
+    0x0000fc0000000000ULL, 0x0000000000000000ULL, 0x0009ffff00000000ULL, 0x0000000000000000ULL,
+    0x000dffff00000000ULL, 0x0000000000000000ULL, 0x001ffffe00000000ULL, 0x0000000000000000ULL,
+    0x001ffffc00000000ULL, 0x0000000000000000ULL, 0x007ffffc00000000ULL, 0x0000000000000000ULL,
+    0x00fffffe00000000ULL, 0x0000000000000000ULL, 0x007ffffff8000000ULL, 0x0000000000000000ULL,
+    0x007ffffff8000000ULL, 0x0000000000000000ULL, 0x00fffffff0000000ULL, 0x0000000000000000ULL,
+    0x01ffffffc0000000ULL, 0x0000000000000000ULL, 0x01ffffffc0000000ULL, 0x0000000000000000ULL,
+    0x01ffffffe0000000ULL, 0x0000000000000000ULL, 0x01ffffffe0000000ULL, 0x0000000000000000ULL,
+    0x01ffffffe0000000ULL, 0x0000000000000000ULL, 0x00fffffff0000000ULL, 0x0000000000000000ULL,
+    0xf8fffffff0000000ULL, 0x0000000000000001ULL, 0xfcfffffff8000000ULL, 0x0000000000000007ULL,
+    0xfffffffffc000000ULL, 0x000000000000000fULL, 0xffffffffe0000000ULL, 0x000000000000001fULL,
+    0xffffffffe0000000ULL, 0x000000000000001fULL, 0xfffffffff0000000ULL, 0x000000000000003fULL,
+    0xfffffffff0000000ULL, 0x000000000000007fULL, 0xfffffffff0000000ULL, 0x00000000000000ffULL,
+    0xfffffffff0000000ULL, 0x00000000000000ffULL, 0xfffffffff0000000ULL, 0x00000000000001ffULL,
+    0xffffffff00000000ULL, 0x00000000000001ffULL, 0xfffffffd00000000ULL, 0x00000000000001ffULL,
+    0xfffffff900000000ULL, 0x00000000000001ffULL, 0xfffffff800000000ULL, 0x00000000000003ffULL,
+    0xfffffff800000000ULL, 0x00000000000003ffULL, 0xfffffff800000000ULL, 0x00000000000003ffULL,
+    0xfffffff000000000ULL, 0x00000000000003ffULL, 0xfffffff000000000ULL, 0x00000000000003ffULL,
+    0xffffffe000000000ULL, 0x00000000000003ffULL, 0xffffffc000000000ULL, 0x00000000000001ffULL,
+    0xffffffc000000000ULL, 0x00000000000001ffULL, 0xffffffe000000000ULL, 0x00000000000003ffULL,
+    0xfffffff800000000ULL, 0x00000000000003ffULL, 0xfffffffe00000000ULL, 0x00000000000007ffULL,
+    0xffffffff00000000ULL, 0x00000000000007ffULL, 0xffffffff80000000ULL, 0x00000000000007ffULL,
+    0xffffffffc0000000ULL, 0x0000000000000fffULL, 0xffffffffc0000000ULL, 0x0000000000000fffULL,
+    0xffffffffe0000000ULL, 0x0000000000001fffULL, 0xfffffffff0000000ULL, 0x0000000000001fffULL,
+    0xfffffffff8000000ULL, 0x0000000000001fffULL, 0xfffffffff8000000ULL, 0x0000000000003fffULL,
+    0xfffffffffc000000ULL, 0x0000000000003fffULL, 0xfffffffffe000000ULL, 0x0000000000003fffULL,
+    0xfffffffffe000000ULL, 0x0000000000003fffULL, 0xffffffffff000000ULL, 0x0000000000003fffULL,
+    0xffffffffff000000ULL, 0x0000000000007fffULL, 0xffffffffff000000ULL, 0x000000000000ffffULL,
+    0xffffffffff800000ULL, 0x000000000000ffffULL, 0xfffffcffff800000ULL, 0x000000000001ffffULL,
+    0xfffffc3fff800000ULL, 0x000000000001ffffULL, 0xfffffc1fff800000ULL, 0x000000000001ffffULL,
+    0xfffff80fff800000ULL, 0x000000000001ffffULL, 0xffffe007ff000000ULL, 0x000000000001ffffULL,
+    0xffffc001ff000000ULL, 0x000000000003ffffULL, 0xffffc001fe000000ULL, 0x000000000003ffffULL,
+    0xffffe0fffe000000ULL, 0x000000000003ffffULL, 0xfffffffff8000000ULL, 0x000000000003ffffULL,
+    0xfffffffff8000000ULL, 0x000000000003ffffULL, 0xfffffffffc000000ULL, 0x000000000007ffffULL,
+    0xfffffffffe000000ULL, 0x000000000007ffffULL, 0xfffffffffe000000ULL, 0x000000000007ffffULL,
+    0xfffffffffe000000ULL, 0x000000000007ffffULL, 0xffffffffff000000ULL, 0x000000000007ffffULL,
+    0xffffffffff000000ULL, 0x000000000007ffffULL, 0xffffffffff000000ULL, 0x000000000007ffffULL,
+    0xffffffffff000000ULL, 0x000000000007ffffULL, 0xffffffffff000000ULL, 0x000000000007ffffULL,
+    0xffffffffff000000ULL, 0x000000000007ffffULL, 0xffffffffff000000ULL, 0x000000000007ffffULL,
+    0xfffffffffe000000ULL, 0x000000000007ffffULL, 0xfffffffffc000000ULL, 0x000000000007ffffULL,
+    0xfffffffff8000000ULL, 0x000000000007ffffULL, 0xfffffffff8000000ULL, 0x000000000007ffffULL,
+    0xffffffffe0000000ULL, 0x000000000007ffffULL, 0xffffffffc0000000ULL, 0x000000000006ffffULL,
+    0xfff1ffff00000000ULL, 0x0000000000067fffULL, 0xffc3fffe00000000ULL, 0x0000000000023fffULL,
+    0xffc3fffe00000000ULL, 0x0000000000001fffULL, 0xff87fff000000000ULL, 0x0000000000000fffULL,
+    0xff0fffc000000000ULL, 0x0000000000000fffULL, 0xfe1fffc000000000ULL, 0x00000000000003ffULL,
+    0xfc1fff8000000000ULL, 0x00000000000000ffULL, 0xf83fff8000000000ULL, 0x00000000000000ffULL,
+    0xf07fff0000000000ULL, 0x00000000000001ffULL, 0xf07ffe0000000000ULL, 0x00000000000001ffULL,
+    0xe07ffe0000000000ULL, 0x00000000000003ffULL, 0xe0fffe0000000000ULL, 0x00000000000003ffULL,
+    0xe0fffe0000000000ULL, 0x00000000000003ffULL, 0xe0ffff8000000000ULL, 0x00000000000003ffULL,
+    0xf0ffffc000000000ULL, 0x00000000000003ffULL, 0xf8fffff800000000ULL, 0x00000000000003ffULL,
+    0xfcfffffc00000000ULL, 0x00000000000003ffULL, 0xfe7ffffe00000000ULL, 0x00000000000007ffULL,
+    0xfffffffe00000000ULL, 0x00000000000007ffULL, 0xffffffff00000000ULL, 0x00000000000067ffULL,
+    0xffffffff00000000ULL, 0x00000000000007ffULL, 0xfffffffff8000000ULL, 0x0000000000003fffULL,
+    0xffffffffff000000ULL, 0x000000000002ffffULL, 0xffffffffeec80000ULL, 0x00000000000effffULL,
+    0xffffffffef000000ULL, 0x000000000001ffffULL, 0xffffffffff000000ULL, 0x000000000000ffffULL,
+    0xffffffff80000000ULL, 0x0000000000003fffULL, 0xffffff0000000000ULL, 0x00000000000001ffULL,
+    0xfffffe0000000000ULL, 0x000000000000003fULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+    0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+};
+
+const HitMask hitmasks[HITMASK_COUNT] = {
+    [HITMASK_ARROW] = {255, 90, 4, 19, 34, 232, 55, arrow_rows},
+    [HITMASK_SWORD] = {344, 110, 6, 4, 46, 332, 90, sword_rows},
+    [HITMASK_STANDING_RIGHT] = {101, 260, 2, 0, 1, 101, 260, standing_right_rows},
+    [HITMASK_STANDING_LEFT] = {101, 260, 2, 0, 1, 101, 260, standing_left_rows},
+    [HITMASK_WALK1_RIGHT] = {101, 260, 2, 0, 1, 100, 260, walk1_right_rows},
+    [HITMASK_WALK1_LEFT] = {101, 260, 2, 1, 1, 101, 260, walk1_left_rows},
+    [HITMASK_WALK2_RIGHT] = {121, 260, 2, 0, 1, 121, 260, walk2_right_rows},
+    [HITMASK_WALK2_LEFT] = {121, 260, 2, 0, 1, 121, 260, walk2_left_rows},
+    [HITMASK_JUMPING_RIGHT] = {234, 260, 4, 2, 0, 234, 260, jumping_right_rows},
+    [HITMASK_JUMPING_LEFT] = {234, 260, 4, 0, 0, 232, 260, jumping_left_rows},
+    [HITMASK_CROUCHING_RIGHT] = {101, 130, 2, 17, 10, 82, 124, crouching_right_rows},
+    [HITMASK_CROUCHING_LEFT] = {101, 130, 2, 19, 10, 84, 124, crouching_left_rows},
+};
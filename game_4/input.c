@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <raylib.h>
+
+#include "input.h"
+#include "pipeline.h"
+
+static const int key_codes[INPUT_KEY_COUNT] = {
+    [INPUT_KEY_LEFT] = KEY_LEFT,
+    [INPUT_KEY_RIGHT] = KEY_RIGHT,
+    [INPUT_KEY_DOWN] = KEY_DOWN,
+    [INPUT_KEY_JUMP] = KEY_SPACE,
+};
+
+void input_queue_init(InputQueue *queue) {
+    memset(queue, 0, sizeof(*queue));
+}
+
+// Main thread only. Returns false, and drops the event, if the queue is full.
+bool input_queue_push(InputQueue *queue, InputEvent event) {
+    uint32_t head = queue->head;
+    if (head - __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) == INPUT_QUEUE_SIZE) {
+        queue->overflows++;
+        return false;
+    }
+    queue->events[head & (INPUT_QUEUE_SIZE - 1)] = event;
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Consumer only: apply the events up to time until and return one tick's
+// input. Keys pressed and released again within the tick count as held for
+// it, and a jump is one tick long.
+InputFrame input_take(InputQueue *queue, InputState *state, double until) {
+    state->pressed = 0;
+    state->press_time = 0;
+    uint32_t tail = queue->tail;
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    for (; tail != head; tail++) {
+        const InputEvent *event = &queue->events[tail & (INPUT_QUEUE_SIZE - 1)];
+        if (event->time > until) {
+            break; // Belongs to a later tick
+        }
+        uint8_t bit = (uint8_t)(1u << event->key);
+        if (!event->down) {
+            state->held &= ~bit;
+            continue;
+        }
+        if (!(state->held & bit)) {
+            state->pressed |= bit;
+            if (state->press_time == 0 || event->time < state->press_time) {
+                state->press_time = event->time;
+            }
+        }
+        state->held |= bit;
+    }
+    __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+
+    uint8_t keys = state->held | state->pressed;
+    InputFrame input = {
+        .left = (keys & (1u << INPUT_KEY_LEFT)) != 0,
+        .right = (keys & (1u << INPUT_KEY_RIGHT)) != 0,
+        .down = (keys & (1u << INPUT_KEY_DOWN)) != 0,
+        .jump = (state->pressed & (1u << INPUT_KEY_JUMP)) != 0,
+    };
+    return input;
+}
+
+void input_sampler_init(InputSampler *sampler) {
+    memset(sampler, 0, sizeof(*sampler));
+}
+
+static void emit(InputSampler *sampler, InputQueue *queue, int key, bool down, double now) {
+    input_queue_push(queue, (InputEvent){now, (uint8_t)key, down});
+    sampler->events++;
+}
+
+// Main thread, after raylib polled events (EndDrawing() or PollInputEvents()):
+// queue what changed since the last sample
+void input_sample(InputSampler *sampler, InputQueue *queue, double now) {
+    if (sampler->polls > 0 && now - sampler->last_poll > sampler->max_gap) {
+        sampler->max_gap = now - sampler->last_poll;
+    }
+    sampler->last_poll = now;
+    sampler->polls++;
+
+    // Presses first: a tap released before this poll only shows up here
+    int code;
+    while ((code = GetKeyPressed()) != 0) {
+        int key = 0;
+        while (key < INPUT_KEY_COUNT && key_codes[key] != code) {
+            key++;
+        }
+        if (key == INPUT_KEY_COUNT) {
+            if (sampler->hotkey_count < INPUT_MAX_HOTKEYS) {
+                sampler->hotkeys[sampler->hotkey_count++] = code;
+            }
+            continue;
+        }
+        uint8_t bit = (uint8_t)(1u << key);
+        if (sampler->held & bit) {
+            emit(sampler, queue, key, false, now); // Released and pressed again since the last poll
+        }
+        emit(sampler, queue, key, true, now);
+        sampler->held |= bit;
+    }
+    for (int key = 0; key < INPUT_KEY_COUNT; key++) {
+        uint8_t bit = (uint8_t)(1u << key);
+        bool down = IsKeyDown(key_codes[key]);
+        if (down != ((sampler->held & bit) != 0)) {
+            emit(sampler, queue, key, down, now);
+            sampler->held ^= bit;
+        }
+    }
+}
+
+static void sleep_seconds(double seconds) {
+    struct timespec wait = {(time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9)};
+    nanosleep(&wait, NULL);
+}
+
+// Main thread: poll the keyboard every INPUT_POLL_INTERVAL_MS until time
+// until. Replaces raylib's frame limiter, which sleeps without polling.
+void input_wait(InputSampler *sampler, InputQueue *queue, double until) {
+    for (;;) {
+        double now = pipeline_now();
+        if (now >= until) {
+            return;
+        }
+        double wait = until - now;
+        sleep_seconds(wait < INPUT_POLL_INTERVAL_MS / 1000 ? wait : INPUT_POLL_INTERVAL_MS / 1000);
+        PollInputEvents();
+        input_sample(sampler, queue, pipeline_now());
+    }
+}
+
+bool input_hotkey_pressed(const InputSampler *sampler, int key) {
+    for (int i = 0; i < sampler->hotkey_count; i++) {
+        if (sampler->hotkeys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void input_clear_hotkeys(InputSampler *sampler) {
+    sampler->hotkey_count = 0;
+}
+
+void input_latency_add(InputLatency *latency, double seconds) {
+    float ms = (float)(seconds * 1000);
+    latency->samples[latency->count % INPUT_LATENCY_SAMPLES] = ms;
+    latency->count++;
+    latency->total_ms += ms;
+    latency->last_ms = ms;
+    if (ms > latency->max_ms) {
+        latency->max_ms = ms;
+    }
+}
+
+static int compare_floats(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// Over the last INPUT_LATENCY_SAMPLES presses; percentile is 0..100
+float input_latency_percentile(const InputLatency *latency, float percentile) {
+    int count = latency->count < INPUT_LATENCY_SAMPLES ? (int)latency->count : INPUT_LATENCY_SAMPLES;
+    if (count == 0) {
+        return 0;
+    }
+    float sorted[INPUT_LATENCY_SAMPLES];
+    memcpy(sorted, latency->samples, count * sizeof(float));
+    qsort(sorted, count, sizeof(float), compare_floats);
+    int index = (int)(percentile / 100 * (count - 1) + 0.5f);
+    return sorted[index];
+}
+
+void input_report(const InputSampler *sampler, const InputQueue *queue, const InputLatency *latency) {
+    printf("input: %ld polls (longest gap %.1f ms), %ld key events, %ld dropped on a full queue\n", sampler->polls,
+           sampler->max_gap * 1000, sampler->events, queue->overflows);
+    if (latency->count > 0) {
+        printf("input to photon: %ld presses, mean %.1f ms, p50 %.1f ms, p99 %.1f ms, max %.1f ms\n", latency->count,
+               latency->total_ms / latency->count, input_latency_percentile(latency, 50),
+               input_latency_percentile(latency, 99), latency->max_ms);
+    }
+}
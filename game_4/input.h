@@ -0,0 +1,90 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+// Keyboard input as timestamped events. The main thread samples the keys
+// every INPUT_POLL_INTERVAL_MS while it waits for the next frame, instead
+// of once per frame, and pushes each change onto a lock-free
+// single-producer, single-consumer queue. The simulation applies an event
+// at the first tick scheduled at or after its timestamp, so a press is late
+// by at most one poll interval plus the rest of its tick, and a tap shorter
+// than a frame still reaches the tick it happened in.
+//
+// Sampling stays on the main thread because GLFW only polls events there.
+// Timestamps are on the pipeline_now() clock.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sim.h"
+
+#define INPUT_QUEUE_SIZE 256       // Events in flight, a power of two
+#define INPUT_POLL_INTERVAL_MS 1.0 // Between polls while waiting for the next frame
+#define INPUT_LATENCY_SAMPLES 512  // Recent input-to-photon times kept for percentiles
+#define INPUT_MAX_HOTKEYS 8        // Other keys pressed per frame, for F1 and the like
+
+typedef enum {
+    INPUT_KEY_LEFT,
+    INPUT_KEY_RIGHT,
+    INPUT_KEY_DOWN,
+    INPUT_KEY_JUMP,
+    INPUT_KEY_COUNT,
+} InputKey;
+
+typedef struct {
+    double time;
+    uint8_t key;  // InputKey
+    uint8_t down; // Pressed, or released
+} InputEvent;
+
+typedef struct {
+    InputEvent events[INPUT_QUEUE_SIZE];
+    uint32_t head; // Next slot the main thread writes
+    uint32_t tail; // Next slot the consumer reads
+    long overflows; // Events dropped on a full queue, main thread only
+} InputQueue;
+
+// Main thread: key state as of the last poll
+typedef struct {
+    uint8_t held; // Bit per InputKey
+    long polls;
+    long events;
+    double last_poll;
+    double max_gap; // Longest time between two polls, frames included
+    // Other keys pressed since input_clear_hotkeys(); IsKeyPressed() only
+    // sees the last poll
+    int hotkeys[INPUT_MAX_HOTKEYS];
+    int hotkey_count;
+} InputSampler;
+
+// Consumer: the keys as the events applied so far leave them
+typedef struct {
+    uint8_t held;
+    uint8_t pressed;   // Pressed since the last input_take(), even if already released
+    double press_time; // Earliest of those presses, 0 if none
+} InputState;
+
+// Input-to-photon times: from a key press to the end of the first frame
+// that shows a tick it affected
+typedef struct {
+    float samples[INPUT_LATENCY_SAMPLES]; // Milliseconds, a ring
+    long count;
+    double total_ms;
+    float max_ms;
+    float last_ms;
+} InputLatency;
+
+void input_queue_init(InputQueue *queue);
+bool input_queue_push(InputQueue *queue, InputEvent event);
+InputFrame input_take(InputQueue *queue, InputState *state, double until);
+
+void input_sampler_init(InputSampler *sampler);
+void input_sample(InputSampler *sampler, InputQueue *queue, double now);
+void input_wait(InputSampler *sampler, InputQueue *queue, double until);
+bool input_hotkey_pressed(const InputSampler *sampler, int key);
+void input_clear_hotkeys(InputSampler *sampler);
+
+void input_latency_add(InputLatency *latency, double seconds);
+float input_latency_percentile(const InputLatency *latency, float percentile);
+void input_report(const InputSampler *sampler, const InputQueue *queue, const InputLatency *latency);
+
+#endif
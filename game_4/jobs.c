@@ -0,0 +1,177 @@
+#include <string.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "jobs.h"
+
+static bool pop_back(JobDeque *deque, JobRange *range) {
+    pthread_mutex_lock(&deque->lock);
+    bool found = deque->back > deque->front;
+    if (found) {
+        *range = deque->ranges[--deque->back];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static bool steal_front(JobDeque *deque, JobRange *range) {
+    pthread_mutex_lock(&deque->lock);
+    bool found = deque->back > deque->front;
+    if (found) {
+        *range = deque->ranges[deque->front++];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+// Run ranges until every deque is empty. self is this thread's deque.
+static void run_ranges(JobPool *pool, int self) {
+    int deque_count = pool->thread_count + 1;
+    for (;;) {
+        JobRange range;
+        bool found = pop_back(&pool->deques[self], &range);
+        for (int i = 1; !found && i < deque_count; i++) {
+            found = steal_front(&pool->deques[(self + i) % deque_count], &range);
+            if (found) {
+                __atomic_fetch_add(&pool->steals, 1, __ATOMIC_RELAXED);
+            }
+        }
+        if (!found) {
+            return;
+        }
+
+        pool->fn(pool->context, range.begin, range.end);
+        if (__atomic_sub_fetch(&pool->pending, 1, __ATOMIC_ACQ_REL) == 0) {
+            pthread_mutex_lock(&pool->lock);
+            pthread_cond_signal(&pool->work_done);
+            pthread_mutex_unlock(&pool->lock);
+        }
+    }
+}
+
+static void *worker_main(void *arg) {
+    JobWorker *worker = (JobWorker *)arg;
+    JobPool *pool = worker->pool;
+    unsigned long seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->quit) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        seen = pool->generation;
+        bool quit = pool->quit;
+        pthread_mutex_unlock(&pool->lock);
+        if (quit) {
+            return NULL;
+        }
+        run_ranges(pool, worker->index);
+    }
+}
+
+// One thread per online core, the caller being one of them
+int jobs_default_threads(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long cores = info.dwNumberOfProcessors;
+#else
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return cores > 1 ? (int)(cores < MAX_JOB_THREADS ? cores - 1 : MAX_JOB_THREADS) : 0;
+}
+
+// Start thread_count workers; the thread calling jobs_parallel_for() also works
+void jobs_init(JobPool *pool, int thread_count) {
+    memset(pool, 0, sizeof(*pool));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+    for (int i = 0; i <= MAX_JOB_THREADS; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+    }
+
+    if (thread_count > MAX_JOB_THREADS) {
+        thread_count = MAX_JOB_THREADS;
+    }
+    for (int i = 0; i < thread_count; i++) {
+        pool->workers[i] = (JobWorker){pool, i};
+        if (pthread_create(&pool->threads[i], NULL, worker_main, &pool->workers[i]) != 0) {
+            break;
+        }
+        pool->thread_count++;
+    }
+}
+
+// Call fn(context, begin, end) over [0, count) in ranges of about grain
+// items, on every thread, and return when all ranges are done. Not reentrant.
+void jobs_parallel_for(JobPool *pool, int count, int grain, JobRangeFn fn, void *context) {
+    if (count <= 0) {
+        return;
+    }
+    int deque_count = pool->thread_count + 1;
+    if (grain < 1) {
+        grain = 1;
+    }
+    int max_ranges = deque_count * JOB_DEQUE_SIZE;
+    if ((count + grain - 1) / grain > max_ranges) {
+        grain = (count + max_ranges - 1) / max_ranges;
+    }
+    int range_count = (count + grain - 1) / grain;
+
+    if (pool->thread_count == 0 || range_count == 1) {
+        fn(context, 0, count);
+        return;
+    }
+
+    // A worker still looking for work from the last loop may take a range
+    // as soon as it is dealt, so fn and pending must be set first
+    pool->fn = fn;
+    pool->context = context;
+    __atomic_store_n(&pool->pending, range_count, __ATOMIC_RELEASE);
+
+    // Deal the ranges round-robin, range r to deque r % deque_count
+    for (int d = 0; d < deque_count; d++) {
+        JobDeque *deque = &pool->deques[d];
+        pthread_mutex_lock(&deque->lock);
+        deque->front = deque->back = 0;
+        for (int r = d; r < range_count; r += deque_count) {
+            int begin = r * grain;
+            deque->ranges[deque->back++] = (JobRange){begin, begin + grain < count ? begin + grain : count};
+        }
+        pthread_mutex_unlock(&deque->lock);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_ranges(pool, pool->thread_count);
+
+    pthread_mutex_lock(&pool->lock);
+    while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void jobs_free(JobPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->thread_count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    for (int i = 0; i <= MAX_JOB_THREADS; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_cond_destroy(&pool->work_done);
+    pthread_mutex_destroy(&pool->lock);
+}
@@ -0,0 +1,61 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+// Work-stealing thread pool for data-parallel loops. jobs_parallel_for()
+// cuts [0, count) into ranges, deals them round-robin onto one deque per
+// thread (the calling thread included) and returns once all have run.
+// Each thread pops from the back of its own deque; when that is empty it
+// steals from the front of the others, so uneven ranges balance out.
+// Threads sleep between loops.
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#define MAX_JOB_THREADS 64
+#define JOB_DEQUE_SIZE 256 // Ranges per thread and loop; the grain grows to fit
+
+typedef void (*JobRangeFn)(void *context, int begin, int end);
+
+typedef struct {
+    int begin;
+    int end;
+} JobRange;
+
+typedef struct {
+    pthread_mutex_t lock;
+    JobRange ranges[JOB_DEQUE_SIZE];
+    int front; // Next range a thief takes
+    int back;  // One past the range the owner takes next
+} JobDeque;
+
+typedef struct JobPool JobPool;
+
+typedef struct {
+    JobPool *pool;
+    int index; // Of the worker's deque
+} JobWorker;
+
+struct JobPool {
+    int thread_count; // Worker threads, not counting the caller
+    pthread_t threads[MAX_JOB_THREADS];
+    JobWorker workers[MAX_JOB_THREADS];
+    JobDeque deques[MAX_JOB_THREADS + 1]; // Last one belongs to the caller
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready; // generation changed or quit
+    pthread_cond_t work_done;  // pending reached zero
+    unsigned long generation;
+    bool quit;
+
+    JobRangeFn fn;
+    void *context;
+    int pending; // Ranges not yet finished, atomic
+    long steals; // Ranges run by a thread other than the one they were dealt to, atomic
+};
+
+int jobs_default_threads(void);
+void jobs_init(JobPool *pool, int thread_count);
+void jobs_parallel_for(JobPool *pool, int count, int grain, JobRangeFn fn, void *context);
+void jobs_free(JobPool *pool);
+
+#endif
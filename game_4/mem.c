@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "mem.h"
+
+#define MEM_MAGIC 0x4D454D42u // "MEMB"
+#define MEM_ALIGN 16
+
+const char *mem_tag_names[MEM_TAG_COUNT] = {
+    [MEM_REPLAY] = "replay",
+    [MEM_HAZARDS] = "hazards",
+    [MEM_BATCH] = "batch",
+};
+
+// In front of every block; the union keeps blocks MEM_ALIGN aligned
+typedef union {
+    struct {
+        size_t size;
+        uint32_t tag;
+        uint32_t magic;
+    } info;
+    unsigned char align[MEM_ALIGN];
+} BlockHeader;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static MemTagStats tags[MEM_TAG_COUNT];
+static long allocation_count; // All tags, read without the lock by mem_allocation_count()
+
+// Bounded mode: one region, blocks bumped off its start
+static unsigned char *arena;
+static size_t arena_size;
+static size_t arena_used;
+static size_t arena_peak;
+
+static size_t round_up(size_t size) {
+    return (size + MEM_ALIGN - 1) & ~(size_t)(MEM_ALIGN - 1);
+}
+
+// Switch to a preallocated region of bytes. Only before the first
+// allocation; returns false then or if the region cannot be had.
+bool mem_use_arena(size_t bytes) {
+    pthread_mutex_lock(&lock);
+    bool ok = arena == NULL && allocation_count == 0 && bytes > 0 && bytes <= SIZE_MAX - MEM_ALIGN;
+    if (ok) {
+        arena_size = round_up(bytes);
+        arena = (unsigned char *)malloc(arena_size);
+        ok = arena != NULL;
+    }
+    if (ok) {
+        memset(arena, 0, arena_size); // Touch every page now, not mid-game
+    }
+    pthread_mutex_unlock(&lock);
+    return ok;
+}
+
+// "64M", "512K", "1G" or plain bytes; 0 if unreadable or too big
+size_t mem_parse_size(const char *text) {
+    if (*text < '0' || *text > '9') {
+        return 0; // strtoull() would take a sign or spaces
+    }
+    errno = 0;
+    char *end;
+    unsigned long long value = strtoull(text, &end, 10);
+    int shift = 0;
+    switch (*end) {
+    case 'G': case 'g': shift = 30; end++; break;
+    case 'M': case 'm': shift = 20; end++; break;
+    case 'K': case 'k': shift = 10; end++; break;
+    }
+    if (*end != '\0' || errno == ERANGE || value > SIZE_MAX >> shift) {
+        return 0;
+    }
+    return (size_t)value << shift;
+}
+
+// --max-mem SIZE: parse it and switch to an arena that big, or say why not
+bool mem_limit_from_arg(const char *arg) {
+    size_t bytes = mem_parse_size(arg);
+    if (bytes == 0) {
+        fprintf(stderr, "--max-mem %s: expected bytes with an optional K, M or G\n", arg);
+        return false;
+    }
+    if (!mem_use_arena(bytes)) {
+        fprintf(stderr, "--max-mem %s: could not reserve that much\n", arg);
+        return false;
+    }
+    return true;
+}
+
+static bool is_newest(const BlockHeader *header) {
+    return (const unsigned char *)(header + 1) + round_up(header->info.size) == arena + arena_used;
+}
+
+// Lock held. Aborts if the arena is exceeded.
+static void arena_reserve(MemTag tag, size_t bytes) {
+    if (bytes > arena_size - arena_used) {
+        fprintf(stderr, "mem: arena exhausted: %s needs %zu more bytes, %zu of %zu in use\n", mem_tag_names[tag],
+                bytes, arena_used, arena_size);
+        pthread_mutex_unlock(&lock);
+        mem_report();
+        fflush(stdout);
+        abort();
+    }
+    arena_used += bytes;
+    if (arena_used > arena_peak) {
+        arena_peak = arena_used;
+    }
+}
+
+static void count_alloc(MemTag tag, size_t size) {
+    tags[tag].allocations++;
+    tags[tag].bytes += size;
+    if (tags[tag].bytes > tags[tag].peak_bytes) {
+        tags[tag].peak_bytes = tags[tag].bytes;
+    }
+    __atomic_add_fetch(&allocation_count, 1, __ATOMIC_RELAXED);
+}
+
+void *mem_alloc(MemTag tag, size_t size) {
+    pthread_mutex_lock(&lock);
+    BlockHeader *header;
+    if (arena != NULL) {
+        header = (BlockHeader *)(arena + arena_used);
+        arena_reserve(tag, sizeof(BlockHeader) + round_up(size));
+    } else {
+        header = (BlockHeader *)malloc(sizeof(BlockHeader) + size);
+    }
+    if (header == NULL) {
+        pthread_mutex_unlock(&lock);
+        return NULL;
+    }
+    header->info.size = size;
+    header->info.tag = tag;
+    header->info.magic = MEM_MAGIC;
+    count_alloc(tag, size);
+    pthread_mutex_unlock(&lock);
+    return header + 1;
+}
+
+void *mem_calloc(MemTag tag, size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *block = mem_alloc(tag, count * size);
+    if (block != NULL) {
+        memset(block, 0, count * size);
+    }
+    return block;
+}
+
+static BlockHeader *header_of(void *block) {
+    BlockHeader *header = (BlockHeader *)block - 1;
+    if (header->info.magic != MEM_MAGIC) {
+        fprintf(stderr, "mem: %p was not allocated by mem_alloc()\n", block);
+        abort();
+    }
+    return header;
+}
+
+void *mem_realloc(MemTag tag, void *block, size_t size) {
+    if (block == NULL) {
+        return mem_alloc(tag, size);
+    }
+    BlockHeader *header = header_of(block);
+    size_t old_size = header->info.size;
+    pthread_mutex_lock(&lock);
+    MemTagStats *stats = &tags[header->info.tag];
+    if (arena == NULL) {
+        BlockHeader *moved = (BlockHeader *)realloc(header, sizeof(BlockHeader) + size);
+        if (moved == NULL) {
+            pthread_mutex_unlock(&lock);
+            return NULL;
+        }
+        header = moved;
+    } else if (is_newest(header)) {
+        // Grow or shrink in place
+        arena_used -= round_up(old_size);
+        arena_reserve(tag, round_up(size));
+    } else {
+        // Copy to a new block; the old one stays used until the arena is gone
+        pthread_mutex_unlock(&lock);
+        void *copy = mem_alloc((MemTag)header->info.tag, size);
+        memcpy(copy, block, old_size < size ? old_size : size);
+        mem_free(block);
+        return copy;
+    }
+    stats->bytes -= old_size;
+    header->info.size = size;
+    count_alloc(header->info.tag, size);
+    pthread_mutex_unlock(&lock);
+    return header + 1;
+}
+
+void mem_free(void *block) {
+    if (block == NULL) {
+        return;
+    }
+    BlockHeader *header = header_of(block);
+    pthread_mutex_lock(&lock);
+    MemTagStats *stats = &tags[header->info.tag];
+    stats->frees++;
+    stats->bytes -= header->info.size;
+    header->info.magic = 0;
+    if (arena == NULL) {
+        free(header);
+    } else if (is_newest(header)) {
+        arena_used = (unsigned char *)header - arena;
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+// Allocations and reallocations so far, all tags; compare two readings to
+// check a frame or tick did none
+long mem_allocation_count(void) {
+    return __atomic_load_n(&allocation_count, __ATOMIC_RELAXED);
+}
+
+void mem_tag_stats(MemTag tag, MemTagStats *stats) {
+    pthread_mutex_lock(&lock);
+    *stats = tags[tag];
+    pthread_mutex_unlock(&lock);
+}
+
+void mem_report(void) {
+    pthread_mutex_lock(&lock);
+    printf("mem: %ld allocations, from %s\n", allocation_count, arena != NULL ? "a fixed arena" : "malloc");
+    size_t live = 0;
+    for (int tag = 0; tag < MEM_TAG_COUNT; tag++) {
+        const MemTagStats *stats = &tags[tag];
+        live += stats->bytes;
+        if (stats->allocations > 0) {
+            printf("  %-8s %6ld allocs %6ld frees %10zu bytes live %10zu peak\n", mem_tag_names[tag],
+                   stats->allocations, stats->frees, stats->bytes, stats->peak_bytes);
+        }
+    }
+    printf("  %zu bytes live", live);
+    if (arena != NULL) {
+        printf(", arena %zu of %zu bytes in use, peak %zu", arena_used, arena_size, arena_peak);
+    }
+    printf("\n");
+    pthread_mutex_unlock(&lock);
+}
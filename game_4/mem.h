@@ -0,0 +1,48 @@
+#ifndef MEM_H
+#define MEM_H
+
+// Tracking allocator for the game's own heap memory. Every block carries a
+// small header with its size and subsystem tag, so counts, live bytes and
+// peaks are kept per tag, and mem_allocation_count() lets a loop check that
+// a frame or tick allocated nothing.
+//
+// By default blocks come from malloc. After mem_use_arena() they come from
+// one region allocated and touched at startup instead: a bump allocator
+// where only the newest block can shrink, grow in place or be given back.
+// Running out of it prints the report and aborts rather than growing.
+//
+// Memory that raylib allocates inside its loaders is not counted.
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum {
+    MEM_REPLAY,  // Recorded input, grows while recording
+    MEM_HAZARDS, // hazards.cfg while it is parsed
+    MEM_BATCH,   // batch_env.h arrays
+    MEM_TAG_COUNT,
+} MemTag;
+
+typedef struct {
+    long allocations; // Blocks handed out, reallocations included
+    long frees;
+    size_t bytes; // Live
+    size_t peak_bytes;
+} MemTagStats;
+
+extern const char *mem_tag_names[MEM_TAG_COUNT];
+
+bool mem_use_arena(size_t bytes);
+size_t mem_parse_size(const char *text);
+bool mem_limit_from_arg(const char *arg);
+
+void *mem_alloc(MemTag tag, size_t size);
+void *mem_calloc(MemTag tag, size_t count, size_t size);
+void *mem_realloc(MemTag tag, void *block, size_t size);
+void mem_free(void *block);
+
+long mem_allocation_count(void);
+void mem_tag_stats(MemTag tag, MemTagStats *stats);
+void mem_report(void);
+
+#endif
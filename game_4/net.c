@@ -0,0 +1,155 @@
+#include <string.h>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+typedef int socklen_t;
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+#include "net.h"
+
+static void close_socket(int socket) {
+#ifdef _WIN32
+    closesocket(socket);
+#else
+    close(socket);
+#endif
+}
+
+// Bind a non-blocking UDP socket to port on every interface, 0 for any free port
+bool net_open(NetLink *link, int port) {
+    memset(link, 0, sizeof(*link));
+    link->socket = -1;
+#ifdef _WIN32
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) {
+        return false;
+    }
+#endif
+    int sock = (int)socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        return false;
+    }
+    struct sockaddr_in address = {0};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t)port);
+    if (bind(sock, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        close_socket(sock);
+        return false;
+    }
+#ifdef _WIN32
+    u_long non_blocking = 1;
+    ioctlsocket(sock, FIONBIO, &non_blocking);
+#else
+    fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+#endif
+    link->socket = sock;
+    return true;
+}
+
+int net_local_port(const NetLink *link) {
+    struct sockaddr_in address;
+    socklen_t size = sizeof(address);
+    if (getsockname(link->socket, (struct sockaddr *)&address, &size) != 0) {
+        return -1;
+    }
+    return ntohs(address.sin_port);
+}
+
+// Send to host:port from now on; only packets from there are received
+bool net_set_peer(NetLink *link, const char *host, int port) {
+    struct addrinfo hints = {0}, *found = NULL;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    if (getaddrinfo(host, NULL, &hints, &found) != 0 || found == NULL) {
+        return false;
+    }
+    link->peer_address = ((struct sockaddr_in *)found->ai_addr)->sin_addr.s_addr;
+    link->peer_port = htons((uint16_t)port);
+    freeaddrinfo(found);
+    return true;
+}
+
+void net_set_conditions(NetLink *link, NetConditions conditions, uint64_t seed) {
+    link->conditions = conditions;
+    rng_seed(&link->rng, seed, 0);
+}
+
+static void send_now(NetLink *link, const void *data, int size) {
+    struct sockaddr_in address = {0};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = link->peer_address;
+    address.sin_port = link->peer_port;
+    sendto(link->socket, (const char *)data, size, 0, (struct sockaddr *)&address, sizeof(address));
+    link->stats.sent++;
+    link->stats.bytes_sent += size;
+}
+
+// Send a packet through the conditioner. now is in seconds on the caller's clock.
+void net_send(NetLink *link, const void *data, int size, double now) {
+    const NetConditions *conditions = &link->conditions;
+    if (conditions->loss > 0 && rng_float(&link->rng) < conditions->loss) {
+        link->stats.dropped++;
+        return;
+    }
+    float delay_ms = conditions->latency_ms + conditions->jitter_ms * (2 * rng_float(&link->rng) - 1);
+    if (delay_ms <= 0 || size > NET_MAX_PACKET) {
+        send_now(link, data, size);
+        return;
+    }
+    if (link->queued == NET_QUEUE_SIZE) {
+        link->stats.dropped++; // A link this backed up loses packets too
+        return;
+    }
+    NetPacket *packet = &link->queue[link->queued++];
+    packet->send_at = now + delay_ms / 1000.0;
+    packet->size = size;
+    memcpy(packet->data, data, size);
+}
+
+// Send the held back packets whose delay has passed
+void net_flush(NetLink *link, double now) {
+    for (int i = 0; i < link->queued;) {
+        NetPacket *packet = &link->queue[i];
+        if (packet->send_at > now) {
+            i++;
+            continue;
+        }
+        send_now(link, packet->data, packet->size);
+        *packet = link->queue[--link->queued];
+    }
+}
+
+// Next packet from the peer, its size, or -1 when none is waiting
+int net_receive(NetLink *link, void *buffer, int size) {
+    for (;;) {
+        struct sockaddr_in from;
+        socklen_t from_size = sizeof(from);
+        int got = (int)recvfrom(link->socket, (char *)buffer, size, 0, (struct sockaddr *)&from, &from_size);
+        if (got < 0) {
+            return -1;
+        }
+        if (from.sin_addr.s_addr == link->peer_address && from.sin_port == link->peer_port) {
+            link->stats.received++;
+            return got;
+        }
+    }
+}
+
+void net_close(NetLink *link) {
+    if (link->socket >= 0) {
+        close_socket(link->socket);
+        link->socket = -1;
+    }
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
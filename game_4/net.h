@@ -0,0 +1,58 @@
+#ifndef NET_H
+#define NET_H
+
+// Non-blocking UDP link to one peer, with a conditioner that delays, jitters
+// and drops outgoing packets to test on localhost what a real network does.
+// Delayed packets wait in a queue and leave on the first net_flush() after
+// their time comes, so callers pick the clock: the game passes real time,
+// tools/loopback.c a simulated one.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rng.h"
+
+#define NET_MAX_PACKET 256
+#define NET_QUEUE_SIZE 256 // Packets held back by the conditioner
+
+// Applied to every packet sent
+typedef struct {
+    float latency_ms; // One way
+    float jitter_ms;  // Latency varies by up to this much either way, which also reorders packets
+    float loss;       // Fraction of packets dropped, 0..1
+} NetConditions;
+
+typedef struct {
+    long sent;
+    long dropped; // By the conditioner
+    long received;
+    long bytes_sent;
+} NetStats;
+
+typedef struct {
+    double send_at;
+    int size;
+    uint8_t data[NET_MAX_PACKET];
+} NetPacket;
+
+typedef struct {
+    int socket; // -1 when closed
+    uint32_t peer_address; // Network byte order
+    uint16_t peer_port;
+    NetConditions conditions;
+    Rng rng; // Loss and jitter draws
+    NetPacket queue[NET_QUEUE_SIZE];
+    int queued;
+    NetStats stats;
+} NetLink;
+
+bool net_open(NetLink *link, int port);
+int net_local_port(const NetLink *link);
+bool net_set_peer(NetLink *link, const char *host, int port);
+void net_set_conditions(NetLink *link, NetConditions conditions, uint64_t seed);
+void net_send(NetLink *link, const void *data, int size, double now);
+void net_flush(NetLink *link, double now);
+int net_receive(NetLink *link, void *buffer, int size);
+void net_close(NetLink *link);
+
+#endif
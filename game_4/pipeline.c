@@ -0,0 +1,163 @@
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "pipeline.h"
+
+// Seconds on a monotonic clock
+double pipeline_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void count(long *counter, long amount) {
+    __atomic_fetch_add(counter, amount, __ATOMIC_RELAXED);
+}
+
+// The earlier of two press times, either of which may be 0 for none
+static double earliest(double a, double b) {
+    return a == 0 ? b : b == 0 ? a : a < b ? a : b;
+}
+
+// Input for the tick scheduled at time tick_time: every key event up to then
+static InputFrame take_input(Pipeline *pipeline, double tick_time) {
+    InputFrame input = input_take(pipeline->input, &pipeline->input_state, tick_time);
+    pipeline->pending_press = earliest(pipeline->pending_press, pipeline->input_state.press_time);
+    return input;
+}
+
+// Fill the simulation's buffer with a view of the finished tick and trade it for the middle one
+static void publish(Pipeline *pipeline) {
+    int index = pipeline->write_index;
+    game_render_view(&pipeline->state, &pipeline->buffers[index]);
+    pipeline->published_at[index] = pipeline_now();
+    pipeline->press_time[index] = pipeline->pending_press;
+    pipeline->pending_press = 0;
+    uint32_t previous = __atomic_exchange_n(&pipeline->middle, index | PIPELINE_FRESH, __ATOMIC_ACQ_REL);
+    if (previous & PIPELINE_FRESH) {
+        count(&pipeline->stats.unseen_ticks, 1);
+        // Never drawn: its press shows first in the next tick published
+        pipeline->pending_press = pipeline->press_time[previous & ~PIPELINE_FRESH];
+    }
+    pipeline->write_index = previous & ~PIPELINE_FRESH;
+}
+
+static void sleep_seconds(double seconds) {
+    struct timespec wait = {(time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9)};
+    nanosleep(&wait, NULL);
+}
+
+static void *simulation_main(void *arg) {
+    Pipeline *pipeline = (Pipeline *)arg;
+    double tick_dt = pipeline->tick_dt;
+    double next_tick = pipeline_now();
+    while (!__atomic_load_n(&pipeline->quit, __ATOMIC_ACQUIRE)) {
+        double now = pipeline_now();
+        if (now < next_tick) {
+            sleep_seconds(next_tick - now);
+            continue;
+        }
+
+        // Behind schedule: catch up, but give up on ticks after a long stall
+        double behind = now - next_tick;
+        if (behind > tick_dt) {
+            count(&pipeline->stats.late_ticks, 1);
+        }
+        if (behind > SIM_MAX_TICKS_PER_FRAME * tick_dt) {
+            count(&pipeline->stats.dropped_ticks, (long)(behind / tick_dt));
+            next_tick = now;
+        }
+
+        InputFrame input = take_input(pipeline, next_tick);
+        if (pipeline->bot != NULL && !pipeline->state.game_over) {
+            input = autoplay_input(pipeline->bot, &pipeline->state);
+        }
+        if (pipeline->replay != NULL) {
+            replay_record(pipeline->replay, input);
+        }
+        double start = pipeline_now();
+        game_step(&pipeline->state, input, pipeline->tick_dt);
+        __atomic_fetch_add(&pipeline->stats.sim_ns, (uint64_t)((pipeline_now() - start) * 1e9), __ATOMIC_RELAXED);
+        count(&pipeline->stats.ticks, 1);
+
+        publish(pipeline);
+        next_tick += tick_dt;
+    }
+    return NULL;
+}
+
+// Hand state to a new simulation thread running tick_rate ticks per second,
+// reading key events from input. replay and bot may be NULL; the thread
+// owns them and the state until pipeline_stop() returns, after which
+// pipeline->state is the final state.
+bool pipeline_start(Pipeline *pipeline, const GameState *state, int tick_rate, InputQueue *input, Replay *replay,
+                    AutoPlayer *bot) {
+    memset(pipeline, 0, sizeof(*pipeline));
+    pipeline->state = *state;
+    pipeline->tick_dt = 1.0f / tick_rate;
+    pipeline->input = input;
+    pipeline->replay = replay;
+    pipeline->bot = bot;
+
+    // The renderer draws the initial state until the first tick is published
+    pipeline->write_index = 0;
+    pipeline->middle = 1;
+    pipeline->read_index = 2;
+    double now = pipeline_now();
+    for (int i = 0; i < PIPELINE_BUFFERS; i++) {
+        game_render_view(state, &pipeline->buffers[i]);
+        pipeline->published_at[i] = now;
+    }
+
+    pipeline->running = pthread_create(&pipeline->thread, NULL, simulation_main, pipeline) == 0;
+    return pipeline->running;
+}
+
+// Main thread: the newest published tick. It stays valid and unchanged
+// until the next call.
+const RenderView *pipeline_acquire(Pipeline *pipeline) {
+    count(&pipeline->stats.frames, 1);
+    if (__atomic_load_n(&pipeline->middle, __ATOMIC_RELAXED) & PIPELINE_FRESH) {
+        uint32_t previous = __atomic_exchange_n(&pipeline->middle, pipeline->read_index, __ATOMIC_ACQ_REL);
+        pipeline->read_index = previous & ~PIPELINE_FRESH;
+        pipeline->acquired_press = pipeline->press_time[pipeline->read_index];
+    } else {
+        count(&pipeline->stats.stale_frames, 1);
+        pipeline->acquired_press = 0;
+    }
+    return &pipeline->buffers[pipeline->read_index];
+}
+
+// Main thread: when the key press that the acquired tick shows first was
+// made, or 0. The frame that draws it ends the input-to-photon time.
+double pipeline_press_time(const Pipeline *pipeline) {
+    return pipeline->acquired_press;
+}
+
+// How far past the acquired tick the frame is drawn, 0..1, for interpolation
+float pipeline_alpha(const Pipeline *pipeline) {
+    float alpha = (pipeline_now() - pipeline->published_at[pipeline->read_index]) / pipeline->tick_dt;
+    return alpha < 0 ? 0 : alpha > 1 ? 1 : alpha;
+}
+
+void pipeline_stats(const Pipeline *pipeline, PipelineStats *stats) {
+    const PipelineStats *live = &pipeline->stats;
+    stats->ticks = __atomic_load_n(&live->ticks, __ATOMIC_RELAXED);
+    stats->late_ticks = __atomic_load_n(&live->late_ticks, __ATOMIC_RELAXED);
+    stats->dropped_ticks = __atomic_load_n(&live->dropped_ticks, __ATOMIC_RELAXED);
+    stats->unseen_ticks = __atomic_load_n(&live->unseen_ticks, __ATOMIC_RELAXED);
+    stats->frames = __atomic_load_n(&live->frames, __ATOMIC_RELAXED);
+    stats->stale_frames = __atomic_load_n(&live->stale_frames, __ATOMIC_RELAXED);
+    stats->sim_ns = __atomic_load_n(&live->sim_ns, __ATOMIC_RELAXED);
+}
+
+// Stop the simulation thread and wait for it to exit
+void pipeline_stop(Pipeline *pipeline) {
+    if (!pipeline->running) {
+        return;
+    }
+    __atomic_store_n(&pipeline->quit, true, __ATOMIC_RELEASE);
+    pthread_join(pipeline->thread, NULL);
+    pipeline->running = false;
+}
@@ -0,0 +1,76 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+// Simulation on its own thread, pipelined with rendering. The simulation
+// thread runs ticks on a fixed schedule and publishes each finished tick
+// through a triple buffer; the main thread draws the newest published tick
+// while the next one is being simulated, so a frame costs about
+// max(sim, render) rather than their sum. The game state itself never
+// leaves the simulation thread: a tick is published as a RenderView of it,
+// the live projectiles and the platforms near the screen.
+//
+// Hand-off is lock-free: each side owns one buffer and they trade with the
+// shared middle one by an atomic exchange of its index. Neither side ever
+// waits for the other. Input arrives as timestamped key events (input.h),
+// each applied at the first tick scheduled at or after it; the tick that
+// applied a press carries the press time so the renderer can measure
+// input-to-photon latency.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "sim.h"
+#include "replay.h"
+#include "autoplay.h"
+#include "input.h"
+
+#define PIPELINE_BUFFERS 3
+#define PIPELINE_FRESH 4u // Set in middle when it holds a tick the renderer has not seen
+
+// Stall counters, each written by one thread and readable from either
+typedef struct {
+    long ticks;
+    long late_ticks;    // Ticks started more than a tick behind schedule: the simulation is too slow
+    long dropped_ticks; // Ticks given up after falling SIM_MAX_TICKS_PER_FRAME behind
+    long unseen_ticks;  // Published ticks replaced before a frame drew them: rendering is too slow
+    long frames;
+    long stale_frames;  // Frames with no new tick since the last one: the simulation stalled or runs slower
+    uint64_t sim_ns;    // Time spent in game_step(), over all ticks
+} PipelineStats;
+
+typedef struct {
+    RenderView buffers[PIPELINE_BUFFERS];
+    double published_at[PIPELINE_BUFFERS]; // pipeline_now() when each buffer was published
+    double press_time[PIPELINE_BUFFERS];   // Earliest key press each buffer shows first, 0 if none
+    uint32_t middle; // Index of the shared buffer, | PIPELINE_FRESH; atomic
+    int write_index; // Simulation thread's buffer
+    int read_index;  // Main thread's buffer
+
+    // Simulation thread only while it runs
+    GameState state;
+    float tick_dt;
+    Replay *replay;  // Records every tick's input, or NULL
+    AutoPlayer *bot; // Plays instead of the keyboard, or NULL
+    InputQueue *input; // Filled by the main thread
+    InputState input_state;
+    double pending_press; // Applied but not yet published, or published and never seen
+
+    double acquired_press; // Main thread: press time of the buffer just acquired, if new
+    bool quit;       // Atomic
+
+    pthread_t thread;
+    bool running;
+    PipelineStats stats;
+} Pipeline;
+
+double pipeline_now(void);
+bool pipeline_start(Pipeline *pipeline, const GameState *state, int tick_rate, InputQueue *input, Replay *replay,
+                    AutoPlayer *bot);
+const RenderView *pipeline_acquire(Pipeline *pipeline);
+double pipeline_press_time(const Pipeline *pipeline);
+float pipeline_alpha(const Pipeline *pipeline);
+void pipeline_stats(const Pipeline *pipeline, PipelineStats *stats);
+void pipeline_stop(Pipeline *pipeline);
+
+#endif
@@ -0,0 +1,217 @@
+#include "profiler.h"
+
+#ifdef ENABLE_PROFILER
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+const char *const profile_zone_names[ZONE_COUNT] = {
+    [ZONE_MUSIC] = "music",
+    [ZONE_AUDIO] = "audio thread",
+    [ZONE_PHYSICS] = "physics",
+    [ZONE_PLATFORMS] = "platforms",
+    [ZONE_SPAWN] = "spawn",
+    [ZONE_PROJECTILES] = "projectiles",
+    [ZONE_COLLISION] = "collision",
+    [ZONE_DRAW_PLATFORMS] = "draw platforms",
+    [ZONE_DRAW_ENTITIES] = "draw entities",
+    [ZONE_DRAW_HUD] = "draw hud",
+};
+
+// One timed block. sequence is the sample's ring position + 1 once it is
+// complete and 0 while a writer fills it, so readers can skip torn samples.
+typedef struct {
+    uint64_t sequence;
+    uint64_t start;
+    uint64_t end;
+    uint64_t frame;
+    uint32_t zone;
+    uint32_t thread;
+} ProfileSample;
+
+static ProfileSample ring[PROFILER_RING_SIZE];
+static uint64_t ring_head; // Samples ever written, claimed with an atomic add
+
+static uint64_t zone_ns[ZONE_COUNT]; // Time per zone in the current frame, atomic adds
+static uint64_t frame_index;
+
+// Main thread only, written by profiler_frame()
+static uint64_t frame_start;
+static float frame_ms[PROFILER_FRAME_HISTORY];
+static float frame_zone_ms[PROFILER_FRAME_HISTORY][ZONE_COUNT];
+static int frames_recorded;
+
+static __thread uint32_t thread_id; // 0 until the thread records its first sample
+static uint32_t thread_count;
+
+// Nanoseconds on a monotonic clock
+uint64_t profiler_now(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+void profiler_record(ProfileZone zone, uint64_t start, uint64_t end) {
+    if (thread_id == 0) {
+        thread_id = __atomic_add_fetch(&thread_count, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_add(&zone_ns[zone], end - start, __ATOMIC_RELAXED);
+
+    uint64_t index = __atomic_fetch_add(&ring_head, 1, __ATOMIC_RELAXED);
+    ProfileSample *sample = &ring[index & (PROFILER_RING_SIZE - 1)];
+    __atomic_store_n(&sample->sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&sample->start, start, __ATOMIC_RELAXED);
+    __atomic_store_n(&sample->end, end, __ATOMIC_RELAXED);
+    __atomic_store_n(&sample->frame, __atomic_load_n(&frame_index, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+    __atomic_store_n(&sample->zone, zone, __ATOMIC_RELAXED);
+    __atomic_store_n(&sample->thread, thread_id, __ATOMIC_RELAXED);
+    __atomic_store_n(&sample->sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+// Call once per frame on the main thread, at the frame boundary
+void profiler_frame(void) {
+    uint64_t now = profiler_now();
+    if (frame_start != 0) {
+        int slot = frames_recorded % PROFILER_FRAME_HISTORY;
+        frame_ms[slot] = (now - frame_start) / 1e6f;
+        for (int zone = 0; zone < ZONE_COUNT; zone++) {
+            frame_zone_ms[slot][zone] = __atomic_exchange_n(&zone_ns[zone], 0, __ATOMIC_RELAXED) / 1e6f;
+        }
+        frames_recorded++;
+    }
+    frame_start = now;
+    __atomic_add_fetch(&frame_index, 1, __ATOMIC_RELAXED);
+}
+
+static int compare_floats(const void *a, const void *b) {
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+void profiler_summary(ProfileSummary *summary) {
+    memset(summary, 0, sizeof(*summary));
+    int frames = frames_recorded < PROFILER_FRAME_HISTORY ? frames_recorded : PROFILER_FRAME_HISTORY;
+    if (frames == 0) {
+        return;
+    }
+
+    float sorted[PROFILER_FRAME_HISTORY];
+    memcpy(sorted, frame_ms, frames * sizeof(float));
+    qsort(sorted, frames, sizeof(float), compare_floats);
+    summary->frames = frames;
+    summary->frame_ms_p50 = sorted[frames * 50 / 100];
+    summary->frame_ms_p90 = sorted[frames * 90 / 100];
+    summary->frame_ms_p99 = sorted[frames * 99 / 100];
+    summary->frame_ms_max = sorted[frames - 1];
+
+    for (int f = 0; f < frames; f++) {
+        for (int zone = 0; zone < ZONE_COUNT; zone++) {
+            summary->zone_ms[zone] += frame_zone_ms[f][zone] / frames;
+        }
+    }
+}
+
+// Copy a sample out of the ring. Returns false if it was overwritten or is
+// still being written.
+static bool read_sample(uint64_t index, ProfileSample *out) {
+    const ProfileSample *sample = &ring[index & (PROFILER_RING_SIZE - 1)];
+    if (__atomic_load_n(&sample->sequence, __ATOMIC_ACQUIRE) != index + 1) {
+        return false;
+    }
+    out->start = __atomic_load_n(&sample->start, __ATOMIC_RELAXED);
+    out->end = __atomic_load_n(&sample->end, __ATOMIC_RELAXED);
+    out->frame = __atomic_load_n(&sample->frame, __ATOMIC_RELAXED);
+    out->zone = __atomic_load_n(&sample->zone, __ATOMIC_RELAXED);
+    out->thread = __atomic_load_n(&sample->thread, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&sample->sequence, __ATOMIC_RELAXED) == index + 1 && out->zone < ZONE_COUNT;
+}
+
+// Write the samples still in the ring as a Chrome trace (complete events,
+// microseconds) and as CSV. Either path may be NULL.
+bool profiler_export(const char *trace_path, const char *csv_path) {
+    uint64_t head = __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE);
+    uint64_t first = head > PROFILER_RING_SIZE ? head - PROFILER_RING_SIZE : 0;
+
+    FILE *trace = trace_path != NULL ? fopen(trace_path, "w") : NULL;
+    FILE *csv = csv_path != NULL ? fopen(csv_path, "w") : NULL;
+    if ((trace_path != NULL && trace == NULL) || (csv_path != NULL && csv == NULL)) {
+        if (trace != NULL) {
+            fclose(trace);
+        }
+        if (csv != NULL) {
+            fclose(csv);
+        }
+        return false;
+    }
+
+    if (trace != NULL) {
+        fprintf(trace, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    }
+    if (csv != NULL) {
+        fprintf(csv, "zone,thread,frame,start_us,duration_us\n");
+    }
+
+    // Threads push samples when their zones end, so ring order is not start
+    // order: find the earliest start first. The second pass reads the same
+    // slots, minus any overwritten meanwhile, so none starts before it.
+    uint64_t origin = UINT64_MAX;
+    for (uint64_t index = first; index < head; index++) {
+        ProfileSample sample;
+        if (read_sample(index, &sample) && sample.start < origin) {
+            origin = sample.start;
+        }
+    }
+
+    bool first_event = true;
+    for (uint64_t index = first; index < head; index++) {
+        ProfileSample sample;
+        if (!read_sample(index, &sample)) {
+            continue;
+        }
+        double start_us = (sample.start - origin) / 1e3;
+        double duration_us = (sample.end - sample.start) / 1e3;
+        if (trace != NULL) {
+            fprintf(trace, "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f, "
+                           "\"args\": {\"frame\": %llu}}",
+                    first_event ? "" : ",\n", profile_zone_names[sample.zone], sample.thread, start_us, duration_us,
+                    (unsigned long long)sample.frame);
+        }
+        if (csv != NULL) {
+            fprintf(csv, "%s,%u,%llu,%.3f,%.3f\n", profile_zone_names[sample.zone], sample.thread,
+                    (unsigned long long)sample.frame, start_us, duration_us);
+        }
+        first_event = false;
+    }
+
+    if (trace != NULL) {
+        fprintf(trace, "\n]}\n");
+        fclose(trace);
+    }
+    if (csv != NULL) {
+        fclose(csv);
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Built-in frame profiler. PROFILE_BEGIN/PROFILE_END time a block as one of
+// the zones below and push the sample into a lock-free ring buffer that any
+// thread may write to. In game, F2 shows frame-time percentiles and per-zone
+// averages, F3 writes the ring out as a Chrome trace (chrome://tracing or
+// ui.perfetto.dev) and as CSV.
+//
+// Build with make PROFILER=1 (defines ENABLE_PROFILER). Without it every
+// macro expands to nothing and profiler.c compiles to an empty object.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    ZONE_MUSIC,       // Posting audio commands on the main thread
+    ZONE_AUDIO,       // Refilling the music stream, on the audio thread
+    ZONE_PHYSICS,
+    ZONE_PLATFORMS,   // character_on_platform
+    ZONE_SPAWN,
+    ZONE_PROJECTILES, // update_projectiles
+    ZONE_COLLISION,
+    ZONE_DRAW_PLATFORMS,
+    ZONE_DRAW_ENTITIES,
+    ZONE_DRAW_HUD,
+    ZONE_COUNT,
+} ProfileZone;
+
+#define PROFILER_RING_SIZE 65536 // Samples kept, a power of two
+#define PROFILER_FRAME_HISTORY 600 // Frame times kept for percentiles
+
+// Averages over the frames in the history, for the overlay
+typedef struct {
+    int frames;
+    float frame_ms_p50;
+    float frame_ms_p90;
+    float frame_ms_p99;
+    float frame_ms_max;
+    float zone_ms[ZONE_COUNT]; // Mean time per frame
+} ProfileSummary;
+
+#ifdef ENABLE_PROFILER
+
+extern const char *const profile_zone_names[ZONE_COUNT];
+
+#define PROFILE_BEGIN(zone) uint64_t profile_start_##zone = profiler_now()
+#define PROFILE_END(zone) profiler_record(zone, profile_start_##zone, profiler_now())
+#define PROFILE_FRAME() profiler_frame()
+
+uint64_t profiler_now(void);
+void profiler_record(ProfileZone zone, uint64_t start, uint64_t end);
+void profiler_frame(void);
+void profiler_summary(ProfileSummary *summary);
+bool profiler_export(const char *trace_path, const char *csv_path);
+
+#else
+
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+#define PROFILE_FRAME()
+
+#endif
+
+#endif
@@ -0,0 +1,179 @@
+#include <float.h>
+#include <stdbool.h>
+
+#include "projectile.h"
+#include "hazard.h"
+
+#define PROJECTILE_LEAVING 0xFE // hazard of a slot update_projectiles() is about to free
+
+// Sizes match img/arrow4.png and img/sward.png
+const ProjectileType projectile_types[PROJECTILE_KIND_COUNT] = {
+    [PROJECTILE_ARROW] = {.name = "arrow", .width = 255, .height = 90, .mask = HITMASK_ARROW},
+    [PROJECTILE_SWORD] = {.name = "sword", .width = 344, .height = 110, .mask = HITMASK_SWORD},
+};
+
+JobPool *projectile_jobs = NULL;
+
+void projectile_set_jobs(JobPool *jobs) {
+    projectile_jobs = jobs;
+}
+
+// Chunks to split the pool into for jobs, or 0 if it is not worth it
+int projectile_chunk_count(const ProjectilePool *pool) {
+    if (projectile_jobs == NULL || projectile_jobs->thread_count == 0 || pool->high_water <= PROJECTILE_CHUNK) {
+        return 0;
+    }
+    return (pool->high_water + PROJECTILE_CHUNK - 1) / PROJECTILE_CHUNK;
+}
+
+void projectile_pool_init(ProjectilePool *pool) {
+    pool->free_head = -1;
+    pool->high_water = 0;
+    pool->count = 0;
+    pool->max_speed = 0;
+    pool->max_step = 0;
+}
+
+// Spawn a projectile of a hazard type (an index into hazards.types) moving
+// left at speed. Returns the slot index, or -1 when the pool is full.
+int projectile_spawn(ProjectilePool *pool, int hazard, float x, float y, float speed) {
+    int index;
+    if (pool->free_head != -1) {
+        index = pool->free_head;
+        pool->free_head = pool->next_free[index];
+    } else if (pool->high_water < MAX_PROJECTILES) {
+        index = pool->high_water++;
+    } else {
+        return -1;
+    }
+
+    const ProjectileType *type = &projectile_types[hazards.types[hazard].sprite];
+    pool->x[index] = x;
+    pool->y[index] = y;
+    pool->prev_x[index] = x;
+    pool->w[index] = type->width;
+    pool->h[index] = type->height;
+    pool->speed[index] = speed;
+    const HitMask *mask = &hitmasks[type->mask];
+    pool->hit_x0[index] = x + mask->x0;
+    pool->hit_y0[index] = y + mask->y0;
+    pool->hit_x1[index] = x + mask->x1;
+    pool->hit_y1[index] = y + mask->y1;
+    pool->hazard[index] = hazard;
+    pool->count++;
+    if (speed > pool->max_speed) {
+        pool->max_speed = speed;
+    }
+    return index;
+}
+
+void projectile_despawn(ProjectilePool *pool, int index) {
+    // Park the slot far away with no speed so the update loop can run over it
+    pool->x[index] = FLT_MAX;
+    pool->prev_x[index] = FLT_MAX;
+    pool->speed[index] = 0;
+    pool->hit_x0[index] = FLT_MAX;
+    pool->hit_x1[index] = -FLT_MAX;
+    pool->hazard[index] = PROJECTILE_NONE;
+    pool->next_free[index] = pool->free_head;
+    pool->free_head = index;
+    pool->count--;
+}
+
+// Give every live projectile its hazard's speed at score
+void projectile_set_speeds(ProjectilePool *pool, int score) {
+    pool->max_speed = 0;
+    for (int i = 0; i < pool->high_water; i++) {
+        if (pool->hazard[i] == PROJECTILE_NONE) {
+            continue;
+        }
+        pool->speed[i] = hazard_speed(&hazards.types[pool->hazard[i]], score);
+        if (pool->speed[i] > pool->max_speed) {
+            pool->max_speed = pool->speed[i];
+        }
+    }
+}
+
+typedef struct {
+    ProjectilePool *pool;
+    float view_left;
+    float dt;
+    bool parallel; // Mark leaving projectiles instead of freeing them
+    int leaving[PROJECTILE_MAX_CHUNKS]; // Per chunk, projectiles marked PROJECTILE_LEAVING
+} UpdateJob;
+
+// Move the projectiles in [begin, end) and free the ones that had left the
+// view before this update, or in parallel only mark them. Returns how many
+// were marked.
+static int move_range(UpdateJob *job, int begin, int end) {
+    ProjectilePool *pool = job->pool;
+    float *x = pool->x;
+    float *prev_x = pool->prev_x;
+    float *hit_x0 = pool->hit_x0;
+    float *hit_x1 = pool->hit_x1;
+    const float *speed = pool->speed;
+    float dt = job->dt;
+
+    for (int i = begin; i < end; i++) {
+        float dx = speed[i] * dt;
+        prev_x[i] = x[i];
+        x[i] -= dx;
+        hit_x0[i] -= dx;
+        hit_x1[i] -= dx;
+    }
+
+    int leaving = 0;
+    for (int i = begin; i < end; i++) {
+        if (pool->hazard[i] != PROJECTILE_NONE && prev_x[i] + pool->w[i] < job->view_left) {
+            if (job->parallel) {
+                pool->hazard[i] = PROJECTILE_LEAVING;
+                leaving++;
+            } else {
+                projectile_despawn(pool, i);
+            }
+        }
+    }
+    return leaving;
+}
+
+static void move_chunks(void *context, int first, int last) {
+    UpdateJob *job = (UpdateJob *)context;
+    for (int chunk = first; chunk < last; chunk++) {
+        int begin = chunk * PROJECTILE_CHUNK;
+        int end = begin + PROJECTILE_CHUNK < job->pool->high_water ? begin + PROJECTILE_CHUNK : job->pool->high_water;
+        job->leaving[chunk] = move_range(job, begin, end);
+    }
+}
+
+// Move every projectile left and remove the ones that had left the view
+// before this update. One that crossed the screen within a single update
+// stays a tick longer, so the swept collision test still sees its path.
+// view_left is the world x of the left screen edge.
+//
+// Moving and marking run in parallel on big pools; freeing the marked
+// slots stays serial and in slot order, which keeps the free list, and so
+// every later spawn, the same whatever the thread count.
+void update_projectiles(ProjectilePool *pool, float view_left, float dt) {
+    UpdateJob job = {.pool = pool, .view_left = view_left, .dt = dt};
+    pool->max_step = pool->max_speed * dt;
+
+    int chunks = projectile_chunk_count(pool);
+    if (chunks == 0) {
+        move_range(&job, 0, pool->high_water);
+        return;
+    }
+
+    job.parallel = true;
+    jobs_parallel_for(projectile_jobs, chunks, 1, move_chunks, &job);
+    for (int chunk = 0; chunk < chunks; chunk++) {
+        if (job.leaving[chunk] == 0) {
+            continue;
+        }
+        int end = (chunk + 1) * PROJECTILE_CHUNK < pool->high_water ? (chunk + 1) * PROJECTILE_CHUNK : pool->high_water;
+        for (int i = chunk * PROJECTILE_CHUNK; i < end; i++) {
+            if (pool->hazard[i] == PROJECTILE_LEAVING) {
+                projectile_despawn(pool, i);
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef PROJECTILE_H
+#define PROJECTILE_H
+
+// Fixed capacity pool of projectiles in structure-of-arrays layout.
+// Free slots are chained in a free list so spawn and despawn are O(1), and
+// loops only run up to high_water, the highest slot ever used.
+//
+// Pools used past PROJECTILE_CHUNK slots are updated and hit tested in
+// chunks on projectile_jobs, when it is set. Each chunk's result has its
+// own slot and they are combined in chunk order, so the outcome is the
+// same with any number of threads. Only one game may step at a time while
+// it is set, and not from inside a job on that pool.
+
+#include <stdbool.h>
+
+#include "hitmask.h"
+#include "jobs.h"
+
+// Pool capacity. The game never has more than a handful of projectiles on
+// screen; stress builds (make bench) raise it on the command line.
+#ifndef MAX_PROJECTILES
+#define MAX_PROJECTILES 256
+#endif
+
+#define PROJECTILE_NONE 0xFF // hazard of a free slot
+
+#define PROJECTILE_CHUNK 4096 // Slots per parallel job
+#define PROJECTILE_MAX_CHUNKS ((MAX_PROJECTILES + PROJECTILE_CHUNK - 1) / PROJECTILE_CHUNK)
+
+typedef enum {
+    PROJECTILE_ARROW,
+    PROJECTILE_SWORD,
+    PROJECTILE_KIND_COUNT,
+} ProjectileKind;
+
+// A projectile sprite. The renderer keeps the matching textures in
+// GameAssets.projectiles, indexed the same way; hazards.cfg picks them by name.
+typedef struct {
+    const char *name;
+    int width;      // Sprite size in pixels
+    int height;
+    HitMaskId mask; // Solid pixels of the sprite, for hits
+} ProjectileType;
+
+extern const ProjectileType projectile_types[PROJECTILE_KIND_COUNT];
+extern JobPool *projectile_jobs; // NULL: every update and hit test runs on the calling thread
+
+typedef struct {
+    float x[MAX_PROJECTILES];
+    float y[MAX_PROJECTILES];
+    float prev_x[MAX_PROJECTILES]; // x at the previous tick, for render interpolation
+    float w[MAX_PROJECTILES];
+    float h[MAX_PROJECTILES];
+    float speed[MAX_PROJECTILES]; // Pixels per second, follows the score (hazard_speed())
+    // Bounds of the type's solid pixels (its hitmask), placed at spawn. Free slots hold
+    // an empty box (x0 = FLT_MAX, x1 = -FLT_MAX) so overlap tests need no branch.
+    float hit_x0[MAX_PROJECTILES];
+    float hit_y0[MAX_PROJECTILES];
+    float hit_x1[MAX_PROJECTILES];
+    float hit_y1[MAX_PROJECTILES];
+    unsigned char hazard[MAX_PROJECTILES]; // Index into hazards.types, or PROJECTILE_NONE
+    int next_free[MAX_PROJECTILES];
+    int free_head;  // First free slot below high_water, -1 if none
+    int high_water; // Slots [0, high_water) have been used at least once
+    int count;      // Live projectiles
+    float max_speed; // Fastest live projectile, or faster
+    float max_step;  // Bound on how far any projectile moved in the last update, for swept tests
+} ProjectilePool;
+
+void projectile_set_jobs(JobPool *jobs);
+int projectile_chunk_count(const ProjectilePool *pool);
+void projectile_pool_init(ProjectilePool *pool);
+int projectile_spawn(ProjectilePool *pool, int hazard, float x, float y, float speed);
+void projectile_despawn(ProjectilePool *pool, int index);
+void projectile_set_speeds(ProjectilePool *pool, int score);
+void update_projectiles(ProjectilePool *pool, float view_left, float dt);
+
+#endif
@@ -0,0 +1,397 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h>
+#include <raylib.h>
+#include <rlgl.h>
+
+#include "render.h"
+#include "profiler.h"
+
+static const int platform1_whitespace = 45;
+static const int platform2_whitespace = 20;
+static const int background_width = 1792;
+static const float background_parallax = 0.055f; // What the old 10-screen world scrolled at
+static const int background_coarse_step = 8; // Pixels it moves at a time at QUALITY_COARSE_BACKGROUND
+#define RIVAL_TINT (Color){ 80, 80, 255, 110 }
+#define BACKGROUND_PLAIN (Color){ 84, 94, 46, 255 } // The background picture's average, at QUALITY_MINIMAL
+#define HUD_CACHE_HEIGHT 180 // Screen rows the cached HUD covers
+
+// Position between the previous and the current tick
+static float lerp(float prev, float current, float alpha) {
+    return prev + (current - prev) * alpha;
+}
+
+// World sprites are grouped by texture before drawing so each texture is
+// bound once per layer. Slots are drawn in this order.
+typedef enum {
+    SLOT_FLOOR,
+    SLOT_PLATFORM2,
+    SLOT_PLATFORM1,
+    SLOT_ARROW,
+    SLOT_SWORD,
+    SLOT_COUNT,
+} SpriteSlot;
+
+#define SPRITE_BATCH_CAPACITY (MAX_PROJECTILES > 256 ? MAX_PROJECTILES : 256)
+
+typedef struct {
+    int count[SLOT_COUNT];
+    Vector2 position[SLOT_COUNT][SPRITE_BATCH_CAPACITY];
+} SpriteBatches;
+
+static SpriteBatches batches;
+
+// Visible world area this frame
+typedef struct {
+    float left;
+    float right;
+} ViewRange;
+
+static void draw_sprite_tinted(Sprite sprite, Vector2 position, Color tint, RenderStats *stats,
+                               unsigned int *bound_texture) {
+    if (sprite.texture.id != *bound_texture) {
+        stats->texture_switches++;
+        *bound_texture = sprite.texture.id;
+    }
+    stats->draw_calls++;
+    DrawTextureRec(sprite.texture, sprite.source, position, tint);
+}
+
+static void draw_sprite(Sprite sprite, Vector2 position, RenderStats *stats, unsigned int *bound_texture) {
+    draw_sprite_tinted(sprite, position, WHITE, stats, bound_texture);
+}
+
+// Queue a sprite if any of it is on screen
+static void batch_sprite(SpriteSlot slot, Sprite sprite, Vector2 position, ViewRange view, RenderStats *stats) {
+    if (position.x >= view.right || position.x + fabsf(sprite.source.width) <= view.left ||
+        batches.count[slot] == SPRITE_BATCH_CAPACITY) {
+        stats->culled_sprites++;
+        return;
+    }
+    batches.position[slot][batches.count[slot]++] = position;
+    stats->visible_sprites++;
+}
+
+static void flush_batches(const Sprite sprites[SLOT_COUNT], SpriteSlot first, SpriteSlot last,
+                          RenderStats *stats, unsigned int *bound_texture) {
+    for (int slot = first; slot <= last; slot++) {
+        for (int i = 0; i < batches.count[slot]; i++) {
+            draw_sprite(sprites[slot], batches.position[slot][i], stats, bound_texture);
+        }
+        batches.count[slot] = 0;
+    }
+}
+
+static void batch_platforms(const RenderView *state, const GameAssets *assets, ViewRange view, RenderStats *stats) {
+    stats->culled_sprites += state->resident_platforms - state->platform_count;
+    for (int v = 0; v < state->platform_count; v++) {
+        const Platform *platform = &state->platforms[v];
+        if (platform->type == FLOOR) {
+            Vector2 position = {platform->x - 20, platform->y - state->floor_spacing};
+            batch_sprite(SLOT_FLOOR, assets->floor_piece, position, view, stats);
+        } else if (platform->number % 2 == 0) {
+            Vector2 position = {platform->x, platform->y - platform2_whitespace};
+            batch_sprite(SLOT_PLATFORM2, assets->platform2, position, view, stats);
+        } else {
+            Vector2 position = {platform->x, platform->y - platform1_whitespace};
+            batch_sprite(SLOT_PLATFORM1, assets->platform1, position, view, stats);
+        }
+    }
+}
+
+static void batch_projectiles(const RenderView *state, const GameAssets *assets, float alpha, ViewRange view,
+                              RenderStats *stats) {
+    for (int i = 0; i < state->projectile_count; i++) {
+        const ViewProjectile *projectile = &state->projectiles[i];
+        Vector2 position = {lerp(projectile->prev_x, projectile->x, alpha), projectile->y};
+        ProjectileKind sprite = hazards.types[projectile->hazard].sprite;
+        SpriteSlot slot = sprite == PROJECTILE_ARROW ? SLOT_ARROW : SLOT_SWORD;
+        batch_sprite(slot, assets->projectiles[sprite], position, view, stats);
+    }
+}
+
+// The pose picks the sprite the same way it picks the hitmask the simulation tests
+static void draw_character(const Character *character, const GameAssets *assets, float alpha, Color tint,
+                           RenderStats *stats, unsigned int *bound_texture) {
+    Vector2 position = {lerp(character->prev_x, character->x, alpha), lerp(character->prev_y, character->y, alpha)};
+    bool left = character->direction == -1;
+    Sprite sprite;
+    switch (character_pose(character)) {
+    case POSE_CROUCHING:
+        sprite = left ? assets->character_crouching_left : assets->character_crouching_right;
+        position.y += CHARACTER_CROUCH_DROP;
+        break;
+    case POSE_JUMPING:
+        sprite = left ? assets->character_jumping_left : assets->character_jumping_right;
+        break;
+    case POSE_WALK1:
+        sprite = left ? assets->character_walk1_left : assets->character_walk1_right;
+        break;
+    case POSE_WALK2:
+        sprite = left ? assets->character_walk2_left : assets->character_walk2_right;
+        break;
+    default:
+        sprite = left ? assets->character_standing_left : assets->character_standing_right;
+        break;
+    }
+    draw_sprite_tinted(sprite, position, tint, stats, bound_texture);
+    stats->visible_sprites++;
+}
+
+// The background scrolls slower than the camera and repeats, the world has
+// no end. Coarse, it moves in whole steps and, being opaque, is drawn
+// without blending.
+static void draw_background(const GameAssets *assets, float camera_x, ViewRange view, bool coarse,
+                            RenderStats *stats, unsigned int *bound_texture) {
+    float background_scroll = -camera_x * background_parallax;
+    float offset = -fmodf(background_scroll, background_width); // From the left edge of the screen
+    if (coarse) {
+        offset = floorf(offset / background_coarse_step) * background_coarse_step;
+        rlDrawRenderBatchActive();
+        rlDisableColorBlend();
+    }
+    int background_x = view.left + offset;
+    draw_sprite(assets->background, (Vector2){background_x, 0}, stats, bound_texture);
+    if (background_x + background_width < view.right) {
+        draw_sprite(assets->background, (Vector2){background_x + background_width, 0}, stats, bound_texture);
+    }
+    if (coarse) {
+        rlDrawRenderBatchActive();
+        rlEnableColorBlend();
+    }
+}
+
+// Who won, once both games of a versus match are over, NULL before
+static const char *versus_result(const RenderView *state, const RenderView *rival) {
+    if (rival == NULL || !state->game_over || !rival->game_over) {
+        return NULL;
+    }
+    return state->score > rival->score ? "You win!" : state->score < rival->score ? "You lose" : "Draw";
+}
+
+// The score, big once the game is over. The game over picture covers the
+// screen, so the small score is not drawn under it.
+static void draw_score(const RenderView *state, const char *result, int width) {
+    const char *score_text = TextFormat("Score: %d", state->score);
+    if (!state->game_over) {
+        DrawText(score_text, 10, 10, 30, RED);
+        return;
+    }
+    DrawText(score_text, width/3+30, 30, 80, BRIGHT_RED);
+    if (result != NULL) {
+        DrawText(result, width/3+30, 120, 50, BRIGHT_RED);
+    }
+}
+
+// At QUALITY_CACHED_HUD and below the score is drawn into a texture only
+// when it changes, about once a second, and the texture every frame. The
+// rival's line stays out of it: it is translucent, and blending it into
+// the texture would fade it twice.
+typedef struct {
+    int score;
+    bool game_over;
+    const char *result;
+} HudKey;
+
+static RenderTexture2D hud_texture;
+static HudKey hud_key;
+static bool hud_valid;
+
+// Returns false if there is no texture to draw the HUD from
+static bool update_hud_cache(const RenderView *state, const char *result, int width) {
+    PROFILE_BEGIN(ZONE_DRAW_HUD);
+    if (hud_texture.id == 0) {
+        hud_texture = LoadRenderTexture(width, HUD_CACHE_HEIGHT);
+        hud_valid = false;
+    }
+    HudKey key = {state->score, state->game_over, result};
+    bool changed = !hud_valid || key.score != hud_key.score || key.game_over != hud_key.game_over ||
+                   key.result != hud_key.result;
+    if (hud_texture.id != 0 && changed) {
+        BeginTextureMode(hud_texture);
+        ClearBackground(BLANK);
+        draw_score(state, result, width);
+        EndTextureMode();
+        hud_key = key;
+        hud_valid = true;
+    }
+    PROFILE_END(ZONE_DRAW_HUD);
+    return hud_texture.id != 0;
+}
+
+void unload_render_cache(void) {
+    if (hud_texture.id != 0) {
+        UnloadRenderTexture(hud_texture);
+        hud_texture = (RenderTexture2D){0};
+        hud_valid = false;
+    }
+}
+
+static void draw_render_stats(const RenderStats *stats) {
+    char text[96];
+    sprintf(text, "sprites %d  culled %d  draws %d  texture switches %d",
+            stats->visible_sprites, stats->culled_sprites, stats->draw_calls, stats->texture_switches);
+    DrawText(text, 10, 50, 20, BLACK);
+
+    // Pipeline stalls: late and dropped ticks mean the simulation is too slow,
+    // unseen ticks that rendering is, stale frames that a frame had no new tick
+    const PipelineStats *pipeline = &stats->pipeline;
+    DrawText(TextFormat("frame %.2f ms  sim %.3f ms/tick  late %ld  dropped %ld  unseen %ld  stale %ld/%ld",
+                        stats->frame_ms, pipeline->ticks > 0 ? pipeline->sim_ns / 1e6 / pipeline->ticks : 0.0,
+                        pipeline->late_ticks, pipeline->dropped_ticks, pipeline->unseen_ticks,
+                        pipeline->stale_frames, pipeline->frames),
+             10, 72, 20, BLACK);
+
+    DrawText(TextFormat("input to photon %.1f ms  p99 %.1f ms  (%ld presses)", stats->input_latency_ms,
+                        stats->input_latency_p99_ms, stats->input_presses),
+             10, 94, 20, BLACK);
+
+    DrawText(TextFormat("quality %s  busy p90 %.2f ms of %.2f ms budget", quality_names[stats->quality],
+                        stats->busy_p90_ms, stats->budget_ms),
+             10, 116, 20, stats->quality != QUALITY_FULL ? RED : BLACK);
+
+    // Netplay: how much was guessed and redone, and whether the peers still agree
+    if (stats->versus) {
+        const RollbackStats *rollback = &stats->rollback;
+        DrawText(TextFormat("rollbacks %ld  deepest %ld  re-simulated %ld  stalls %ld  desyncs %ld",
+                            rollback->rollbacks, rollback->rollback_depth_max, rollback->resimulated_ticks,
+                            rollback->stalls, rollback->desyncs),
+                 10, 138, 20, rollback->desyncs > 0 ? RED : BLACK);
+    }
+}
+
+#ifdef ENABLE_PROFILER
+// Frame-time percentiles and where the time went, over the profiler's history
+static void draw_profiler_overlay(int y) {
+    ProfileSummary summary;
+    profiler_summary(&summary);
+    int x = 10;
+    DrawText(TextFormat("frame ms  p50 %.2f  p90 %.2f  p99 %.2f  max %.2f  (%d frames)", summary.frame_ms_p50,
+                        summary.frame_ms_p90, summary.frame_ms_p99, summary.frame_ms_max, summary.frames),
+             x, y, 20, BLACK);
+    for (int zone = 0; zone < ZONE_COUNT; zone++) {
+        y += 22;
+        DrawText(TextFormat("%-16s %.3f ms", profile_zone_names[zone], summary.zone_ms[zone]), x, y, 20, BLACK);
+    }
+}
+#endif
+
+// alpha is pipeline_alpha(): how far the frame lies between the last two ticks.
+// rival is the other player's game in versus mode, NULL otherwise; only its
+// character and score are drawn, the hazards it dodges are its own.
+// stats receives this frame's counters; they are drawn on screen if stats->overlay is set.
+void draw_game(const RenderView *state, const RenderView *rival, const GameAssets *assets, float alpha,
+               RenderStats *stats) {
+    int width = state->width;
+    int height = state->height;
+
+    Camera2D camera = {
+        .offset = (Vector2){.x = lerp(state->prev_camera_x, state->camera_x, alpha), .y = 0},
+        .target = (Vector2){.x = 0, .y = 0},
+        .rotation = 0.0,
+        .zoom = 1.0
+    };
+
+    ViewRange view = {.left = -camera.offset.x, .right = -camera.offset.x + width};
+    bool overlay = stats->overlay;
+    RenderStats previous = *stats;
+    *stats = (RenderStats){.overlay = overlay, .profiler_overlay = previous.profiler_overlay, .versus = previous.versus,
+                           .quality = previous.quality};
+    QualityLevel quality = previous.quality;
+    unsigned int bound_texture = 0;
+    Sprite slot_sprites[SLOT_COUNT] = {
+        [SLOT_FLOOR] = assets->floor_piece,
+        [SLOT_PLATFORM2] = assets->platform2,
+        [SLOT_PLATFORM1] = assets->platform1,
+        [SLOT_ARROW] = assets->projectiles[PROJECTILE_ARROW],
+        [SLOT_SWORD] = assets->projectiles[PROJECTILE_SWORD],
+    };
+
+    // Before BeginDrawing(): the HUD texture is a render target of its own
+    const char *result = versus_result(state, rival);
+    bool cached_hud = quality >= QUALITY_CACHED_HUD && update_hud_cache(state, result, width);
+
+    BeginDrawing();
+    BeginMode2D(camera);
+
+    // Clear the background, and draw the picture over it unless shedding it
+    ClearBackground(quality >= QUALITY_MINIMAL ? BACKGROUND_PLAIN : WHITE);
+    if (quality < QUALITY_MINIMAL) {
+        draw_background(assets, camera.offset.x, view, quality >= QUALITY_COARSE_BACKGROUND, stats, &bound_texture);
+    }
+
+    // Draw character platforms that are on screen, one texture at a time
+    PROFILE_BEGIN(ZONE_DRAW_PLATFORMS);
+    batch_platforms(state, assets, view, stats);
+    flush_batches(slot_sprites, SLOT_FLOOR, SLOT_PLATFORM1, stats, &bound_texture);
+    PROFILE_END(ZONE_DRAW_PLATFORMS);
+
+    // Draw the character, and in versus the rival's faded over it
+    PROFILE_BEGIN(ZONE_DRAW_ENTITIES);
+    if (rival != NULL && quality < QUALITY_MINIMAL) {
+        draw_character(&rival->character, assets, alpha, RIVAL_TINT, stats, &bound_texture);
+    }
+    draw_character(&state->character, assets, alpha, WHITE, stats, &bound_texture);
+
+    // Draw arrows and swords that are on screen, one texture at a time
+    batch_projectiles(state, assets, alpha, view, stats);
+    flush_batches(slot_sprites, SLOT_ARROW, SLOT_SWORD, stats, &bound_texture);
+    PROFILE_END(ZONE_DRAW_ENTITIES);
+
+    EndMode2D();
+
+    // Draw the rival's score, or the game over screen over everything
+    PROFILE_BEGIN(ZONE_DRAW_HUD);
+    if (state->game_over) {
+        Sprite game_over = assets->game_over;
+        Vector2 game_over_pos = {width/2 - (int)game_over.source.width/2, height/2 - (int)game_over.source.height/2};
+        draw_sprite(game_over, game_over_pos, stats, &bound_texture);
+    } else if (rival != NULL) {
+        DrawText(TextFormat("Rival: %d%s", rival->score, rival->game_over ? " (out)" : ""), width - 260, 10, 30,
+                 RIVAL_TINT);
+    }
+
+    // Draw score; render textures are stored upside down
+    if (cached_hud) {
+        Rectangle source = {0, 0, hud_texture.texture.width, -hud_texture.texture.height};
+        DrawTextureRec(hud_texture.texture, source, (Vector2){0, 0}, WHITE);
+        stats->draw_calls++;
+    } else {
+        draw_score(state, result, width);
+    }
+
+    if (overlay) {
+        draw_render_stats(&previous);
+    }
+#ifdef ENABLE_PROFILER
+    if (stats->profiler_overlay) {
+        draw_profiler_overlay(!overlay ? 102 : previous.versus ? 168 : 146); // Below the draw counters
+    }
+#endif
+    PROFILE_END(ZONE_DRAW_HUD);
+
+    EndDrawing();
+}
+
+// Shown while asset_loader.h works. progress is 0..1.
+void draw_loading_screen(int width, int height, float progress) {
+    int bar_width = width / 2;
+    int bar_height = 24;
+    int bar_x = width / 2 - bar_width / 2;
+    int bar_y = height / 2;
+
+    BeginDrawing();
+    ClearBackground(WHITE);
+    DrawText("Loading...", bar_x, bar_y - 50, 30, DARKGREEN);
+    DrawRectangle(bar_x, bar_y, (int)(bar_width * progress), bar_height, DARKGREEN);
+    DrawRectangleLines(bar_x, bar_y, bar_width, bar_height, DARKGREEN);
+    EndDrawing();
+}
+
+// Shown in versus mode until the peers connect
+void draw_waiting_screen(int width, int height, const char *text) {
+    BeginDrawing();
+    ClearBackground(WHITE);
+    DrawText(text, width / 2 - MeasureText(text, 30) / 2, height / 2 - 15, 30, DARKGREEN);
+    EndDrawing();
+}
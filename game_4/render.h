@@ -0,0 +1,43 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+// Drawing of a tick, as game_render_view() copies it out, with raylib.
+
+#include <stdbool.h>
+#include <raylib.h>
+#include "sim.h"
+#include "assets.h"
+#include "pipeline.h"
+#include "rollback.h"
+#include "governor.h"
+
+#define BRIGHT_RED (Color){ 255, 0, 0, 255 }
+
+// Per-frame draw counters, to check draw cost follows what is on screen
+typedef struct {
+    int visible_sprites;  // World sprites drawn
+    int culled_sprites;   // World sprites skipped because they are off screen
+    int draw_calls;       // DrawTexture calls
+    int texture_switches; // Draws that used a different texture than the one before
+    bool overlay;         // Show the previous frame's counters on screen
+    bool profiler_overlay; // Show profiler percentiles (PROFILER=1 builds only)
+    // Set by the caller before draw_game(), shown with the counters
+    float frame_ms;
+    PipelineStats pipeline;
+    float input_latency_ms;     // Input to photon, for the newest key press shown
+    float input_latency_p99_ms; // Over recent presses
+    long input_presses;
+    bool versus;
+    RollbackStats rollback;
+    QualityLevel quality; // From the governor, kept by draw_game()
+    float busy_p90_ms;    // The governor's last window
+    float budget_ms;
+} RenderStats;
+
+void draw_game(const RenderView *state, const RenderView *rival, const GameAssets *assets, float alpha,
+               RenderStats *stats);
+void unload_render_cache(void);
+void draw_loading_screen(int width, int height, float progress);
+void draw_waiting_screen(int width, int height, const char *text);
+
+#endif
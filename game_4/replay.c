@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "replay.h"
+#include "mem.h"
+
+#define RUN_SHORT_MAX 15 // Runs up to this long fit in the high nibble of the run byte
+
+static void put_byte(Replay *replay, uint8_t byte) {
+    if (replay->size == replay->capacity) {
+        replay->capacity = replay->capacity ? replay->capacity * 2 : 4096;
+        replay->data = (uint8_t *)mem_realloc(MEM_REPLAY, replay->data, replay->capacity);
+    }
+    replay->data[replay->size++] = byte;
+}
+
+// Write the pending run: bits and length in one byte, or bits and a
+// zero nibble followed by the length as a LEB128 varint
+static void flush_run(Replay *replay) {
+    if (replay->run_length == 0) {
+        return;
+    }
+    if (replay->run_length <= RUN_SHORT_MAX) {
+        put_byte(replay, replay->run_bits | replay->run_length << 4);
+    } else {
+        put_byte(replay, replay->run_bits);
+        uint32_t length = replay->run_length;
+        while (length >= 0x80) {
+            put_byte(replay, (length & 0x7F) | 0x80);
+            length >>= 7;
+        }
+        put_byte(replay, length);
+    }
+    replay->run_length = 0;
+}
+
+void replay_init(Replay *replay, uint64_t seed, int tick_rate, int width, int height) {
+    memset(replay, 0, sizeof(*replay));
+    memcpy(replay->header.magic, REPLAY_MAGIC, 4);
+    replay->header.version = REPLAY_VERSION;
+    replay->header.seed = seed;
+    replay->header.tick_rate = tick_rate;
+    replay->header.width = width;
+    replay->header.height = height;
+}
+
+// Append the input of one tick, as passed to game_step()
+void replay_record(Replay *replay, InputFrame input) {
+    uint8_t bits = input_bits(input);
+    if (replay->run_length > 0 && (bits != replay->run_bits || replay->run_length == UINT32_MAX)) {
+        flush_run(replay);
+    }
+    replay->run_bits = bits;
+    replay->run_length++;
+    replay->header.tick_count++;
+}
+
+bool replay_save(Replay *replay, const char *path, const GameState *final_state) {
+    flush_run(replay);
+    replay->header.final_score = final_state->score;
+    replay->header.final_hash = game_state_hash(final_state);
+    replay->header.input_size = (uint32_t)replay->size;
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+    bool ok = fwrite(&replay->header, sizeof(replay->header), 1, file) == 1 &&
+              fwrite(replay->data, 1, replay->size, file) == replay->size;
+    return fclose(file) == 0 && ok;
+}
+
+// Whether a loaded header can be played back, with input_bytes left in its file
+static bool header_valid(const ReplayHeader *header, long input_bytes) {
+    return memcmp(header->magic, REPLAY_MAGIC, 4) == 0 && header->version == REPLAY_VERSION &&
+           header->tick_rate > 0 && header->tick_rate <= REPLAY_MAX_TICK_RATE && header->width > 0 &&
+           header->width <= REPLAY_MAX_DIMENSION && header->height > 0 && header->height <= REPLAY_MAX_DIMENSION &&
+           input_bytes >= 0 && (unsigned long)input_bytes == header->input_size;
+}
+
+bool replay_load(Replay *replay, const char *path) {
+    memset(replay, 0, sizeof(*replay));
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool ok = fread(&replay->header, sizeof(replay->header), 1, file) == 1;
+    if (ok) {
+        // The input must be the rest of the file, before anything is allocated for it
+        long start = ftell(file);
+        long end = start >= 0 && fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+        ok = end >= 0 && fseek(file, start, SEEK_SET) == 0 && header_valid(&replay->header, end - start);
+    }
+    if (ok) {
+        replay->size = replay->capacity = replay->header.input_size;
+        replay->data = (uint8_t *)mem_alloc(MEM_REPLAY, replay->size > 0 ? replay->size : 1);
+        ok = fread(replay->data, 1, replay->size, file) == replay->size;
+    }
+    fclose(file);
+    if (!ok) {
+        replay_free(replay);
+    }
+    return ok;
+}
+
+// Input of the next tick. Returns false at the end of the recording.
+bool replay_next(Replay *replay, InputFrame *input) {
+    if (replay->read_remaining == 0) {
+        if (replay->read_pos >= replay->size) {
+            return false;
+        }
+        uint8_t byte = replay->data[replay->read_pos++];
+        replay->read_bits = byte & 0x0F;
+        replay->read_remaining = byte >> 4;
+        if (replay->read_remaining == 0) {
+            uint32_t length = 0;
+            for (int shift = 0; replay->read_pos < replay->size && shift < 32; shift += 7) {
+                uint8_t part = replay->data[replay->read_pos++];
+                length |= (uint32_t)(part & 0x7F) << shift;
+                if ((part & 0x80) == 0) {
+                    break;
+                }
+            }
+            replay->read_remaining = length;
+            if (length == 0) {
+                return false;
+            }
+        }
+    }
+    replay->read_remaining--;
+    *input = input_from_bits(replay->read_bits);
+    return true;
+}
+
+void replay_free(Replay *replay) {
+    mem_free(replay->data);
+    replay->data = NULL;
+    replay->size = replay->capacity = 0;
+}
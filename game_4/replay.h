@@ -0,0 +1,60 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// Input recordings. A replay is the seed and tick rate of a run plus the
+// InputFrame of every tick, run-length coded: a byte with the four input
+// bits and the run length, followed by a varint when the run is long. Held
+// keys cost a few bytes per press, so minutes of play fit in a few KB.
+// With the seed and inputs the simulation is deterministic, so replaying
+// reaches the same final state; the file stores its score and hash to check.
+//
+// File layout, little endian: ReplayHeader, then input_size bytes of runs.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sim.h"
+
+#define REPLAY_MAGIC "SJRP"
+#define REPLAY_VERSION 4 // Bumped whenever the simulation changes what an input does, or the state hash
+#define REPLAY_MAX_TICK_RATE 10000 // Hz; headers outside these limits are rejected by replay_load()
+#define REPLAY_MAX_DIMENSION 16384 // Pixels, width and height
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint64_t seed;
+    uint64_t final_hash; // game_state_hash() after the last tick
+    uint32_t tick_rate;
+    uint32_t width;
+    uint32_t height;
+    uint32_t tick_count;
+    int32_t final_score;
+    uint32_t input_size;
+} ReplayHeader;
+
+typedef struct {
+    ReplayHeader header;
+    uint8_t *data; // Encoded runs
+    size_t size;
+    size_t capacity;
+
+    // Recording: the run not yet written
+    uint8_t run_bits;
+    uint32_t run_length;
+
+    // Playback
+    size_t read_pos;
+    uint32_t read_remaining;
+    uint8_t read_bits;
+} Replay;
+
+void replay_init(Replay *replay, uint64_t seed, int tick_rate, int width, int height);
+void replay_record(Replay *replay, InputFrame input);
+bool replay_save(Replay *replay, const char *path, const GameState *final_state);
+bool replay_load(Replay *replay, const char *path);
+bool replay_next(Replay *replay, InputFrame *input);
+void replay_free(Replay *replay);
+
+#endif
@@ -0,0 +1,57 @@
+#include "rng.h"
+
+#define PCG_MULTIPLIER 6364136223846793005ULL
+
+static uint32_t pcg_output(uint64_t state) {
+    uint32_t xorshifted = (uint32_t)(((state >> 18) ^ state) >> 27);
+    uint32_t rotation = (uint32_t)(state >> 59);
+    return (xorshifted >> rotation) | (xorshifted << ((32 - rotation) & 31));
+}
+
+void rng_seed(Rng *rng, uint64_t seed, uint64_t stream) {
+    rng->state = 0;
+    rng->increment = (stream << 1) | 1;
+    rng_next(rng);
+    rng->state += seed;
+    rng_next(rng);
+}
+
+uint32_t rng_next(Rng *rng) {
+    uint64_t state = rng->state;
+    rng->state = state * PCG_MULTIPLIER + rng->increment;
+    return pcg_output(state);
+}
+
+// Uniform in [0, 1)
+float rng_float(Rng *rng) {
+    return (rng_next(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+// Uniform in [0, bound) for bound > 0, by multiply and shift instead of %.
+// The bias is below bound / 2^32, far too small to matter here.
+int rng_range(Rng *rng, int bound) {
+    return (int)(((uint64_t)rng_next(rng) * (uint32_t)bound) >> 32);
+}
+
+// Next count values, the same ones count rng_next() calls would give. The
+// state is kept in a register for the whole loop.
+void rng_fill(Rng *rng, uint32_t *out, int count) {
+    uint64_t state = rng->state;
+    uint64_t increment = rng->increment;
+    for (int i = 0; i < count; i++) {
+        out[i] = pcg_output(state);
+        state = state * PCG_MULTIPLIER + increment;
+    }
+    rng->state = state;
+}
+
+// Next count values of rng_float()
+void rng_fill_floats(Rng *rng, float *out, int count) {
+    uint64_t state = rng->state;
+    uint64_t increment = rng->increment;
+    for (int i = 0; i < count; i++) {
+        out[i] = (pcg_output(state) >> 8) * (1.0f / 16777216.0f);
+        state = state * PCG_MULTIPLIER + increment;
+    }
+    rng->state = state;
+}
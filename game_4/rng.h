@@ -0,0 +1,29 @@
+#ifndef RNG_H
+#define RNG_H
+
+// Seedable random numbers (PCG32). Every Rng is its own stream: the same
+// seed with different stream numbers gives independent sequences, so each
+// subsystem draws from its own generator and none of them share state.
+
+#include <stdint.h>
+
+typedef struct {
+    uint64_t state;
+    uint64_t increment; // Odd, selects the stream
+} Rng;
+
+// Streams a GameState owns, one per subsystem
+typedef enum {
+    RNG_WORLD,   // World seed; each chunk then gets its own stream
+    RNG_SPAWN,   // Projectile spawn heights
+    RNG_STREAM_COUNT,
+} RngStream;
+
+void rng_seed(Rng *rng, uint64_t seed, uint64_t stream);
+uint32_t rng_next(Rng *rng);
+float rng_float(Rng *rng);
+int rng_range(Rng *rng, int bound);
+void rng_fill(Rng *rng, uint32_t *out, int count);
+void rng_fill_floats(Rng *rng, float *out, int count);
+
+#endif
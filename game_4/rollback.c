@@ -0,0 +1,388 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "rollback.h"
+
+#define PACKET_MAGIC 0x534A5653u // "SJVS"
+#define PACKET_SYNC 1
+#define PACKET_INPUT 2
+#define SYNC_INTERVAL 0.1 // Seconds between hellos while connecting
+
+#define HISTORY_MASK (ROLLBACK_HISTORY - 1)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Little endian packet fields
+typedef struct {
+    uint8_t *data;
+    int size;
+    int pos;
+} Packet;
+
+static void put(Packet *packet, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes && packet->pos < packet->size; i++) {
+        packet->data[packet->pos++] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint64_t get(Packet *packet, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value |= (uint64_t)(packet->pos < packet->size ? packet->data[packet->pos] : 0) << (8 * i);
+        packet->pos++;
+    }
+    return value;
+}
+
+uint64_t versus_hash(const VersusState *state) {
+    return game_state_hash(&state->players[0]) * 0x100000001B3ULL ^ game_state_hash(&state->players[1]);
+}
+
+static void start_games(RollbackSession *session) {
+    for (int player = 0; player < 2; player++) {
+        game_init(&session->state.players[player], session->width, session->height, session->seed);
+    }
+    // Ticks before the first sampled input run with no keys held
+    memset(session->inputs, 0, sizeof(session->inputs));
+    session->known[0] = session->known[1] = session->input_delay;
+    session->peer_acked = session->input_delay;
+}
+
+// The link is not touched: open it afterwards with net_open() and net_set_peer()
+void rollback_init(RollbackSession *session, int player, uint64_t seed, int tick_rate, int width, int height,
+                   int input_delay) {
+    memset(session, 0, sizeof(*session));
+    session->link.socket = -1;
+    session->local = player;
+    session->seed = seed;
+    session->tick_rate = tick_rate;
+    session->tick_dt = 1.0f / tick_rate;
+    session->width = width;
+    session->height = height;
+    session->input_delay = input_delay;
+    session->last_send = -1;
+    session->stats.first_desync_tick = -1;
+    start_games(session);
+}
+
+static void send_sync(RollbackSession *session, bool heard, double now) {
+    uint8_t data[NET_MAX_PACKET];
+    Packet packet = {data, sizeof(data), 0};
+    put(&packet, PACKET_MAGIC, 4);
+    put(&packet, PACKET_SYNC, 1);
+    put(&packet, session->local, 1);
+    put(&packet, heard, 1);
+    put(&packet, session->seed, 8);
+    put(&packet, session->tick_rate, 2);
+    put(&packet, session->width, 2);
+    put(&packet, session->height, 2);
+    put(&packet, session->input_delay, 1);
+    put(&packet, hazards.hash, 8);
+    net_send(&session->link, data, packet.pos, now);
+    session->last_send = now;
+}
+
+// Every local input the peer has not acknowledged, our acknowledgement of
+// theirs, our tick for time sync and the newest final state hash
+static void send_inputs(RollbackSession *session, double now) {
+    long first = session->peer_acked + 1;
+    long last = session->known[session->local];
+    if (last - first + 1 > ROLLBACK_MAX_RESEND) {
+        last = first + ROLLBACK_MAX_RESEND - 1;
+    }
+    int count = last >= first ? (int)(last - first + 1) : 0;
+
+    uint8_t data[NET_MAX_PACKET];
+    Packet packet = {data, sizeof(data), 0};
+    put(&packet, PACKET_MAGIC, 4);
+    put(&packet, PACKET_INPUT, 1);
+    put(&packet, first, 4);
+    put(&packet, count, 1);
+    for (long t = first; t <= last; t++) {
+        put(&packet, session->inputs[session->local][t & HISTORY_MASK], 1);
+    }
+    put(&packet, session->known[1 - session->local], 4);
+    put(&packet, session->tick, 4);
+    put(&packet, (int16_t)(session->tick - session->peer_tick), 2);
+    int newest = 0;
+    for (int i = 1; i < ROLLBACK_HASHES; i++) {
+        newest = session->hash_ticks[i] > session->hash_ticks[newest] ? i : newest;
+    }
+    put(&packet, session->hash_ticks[newest], 4);
+    put(&packet, session->hashes[newest], 8);
+    net_send(&session->link, data, packet.pos, now);
+    session->last_send = now;
+}
+
+static void compare_hash(RollbackSession *session, long tick, uint64_t local_hash, uint64_t peer_hash) {
+    session->compared_tick = tick;
+    session->stats.hash_checks++;
+    if (local_hash != peer_hash) {
+        session->stats.desyncs++;
+        if (session->stats.first_desync_tick < 0) {
+            session->stats.first_desync_tick = tick;
+            fprintf(stderr, "versus: desync at tick %ld (%016llx here, %016llx on the peer)\n", tick,
+                    (unsigned long long)local_hash, (unsigned long long)peer_hash);
+        }
+    }
+}
+
+// Run tick t on top of the current state, with the remote input if it is
+// known and the prediction from the newest known one otherwise
+static void simulate(RollbackSession *session, long t) {
+    int local = session->local, remote = 1 - local;
+    session->saved[t % ROLLBACK_SAVED] = session->state;
+
+    uint8_t remote_bits;
+    if (t <= session->known[remote]) {
+        remote_bits = session->inputs[remote][t & HISTORY_MASK];
+    } else {
+        InputFrame guess = input_from_bits(session->inputs[remote][session->known[remote] & HISTORY_MASK]);
+        guess.jump = false; // A press is one tick long, repeating it would jump again
+        remote_bits = input_bits(guess);
+    }
+    session->used[t & HISTORY_MASK] = remote_bits;
+
+    InputFrame inputs[2];
+    inputs[local] = input_from_bits(session->inputs[local][t & HISTORY_MASK]);
+    inputs[remote] = input_from_bits(remote_bits);
+    for (int player = 0; player < 2; player++) {
+        game_step(&session->state.players[player], inputs[player], session->tick_dt);
+    }
+    session->tick = t;
+}
+
+// Hash the ticks that just became final, and compare if the peer's hash is in
+static void confirm(RollbackSession *session) {
+    long known = session->known[1 - session->local];
+    long confirmed = known < session->tick ? known : session->tick;
+    for (long t = session->confirmed + 1; t <= confirmed; t++) {
+        if (t % ROLLBACK_HASH_INTERVAL != 0) {
+            continue;
+        }
+        // State after t: the current one, or the one saved before t + 1
+        const VersusState *state = t == session->tick ? &session->state : &session->saved[(t + 1) % ROLLBACK_SAVED];
+        int slot = (int)(t / ROLLBACK_HASH_INTERVAL % ROLLBACK_HASHES);
+        session->hash_ticks[slot] = t;
+        session->hashes[slot] = versus_hash(state);
+        if (session->peer_hash_tick == t) {
+            compare_hash(session, t, session->hashes[slot], session->peer_hash);
+            session->peer_hash_tick = 0;
+        }
+    }
+    session->confirmed = confirmed > session->confirmed ? confirmed : session->confirmed;
+}
+
+// Go back to the first wrongly guessed tick and simulate up to the present again
+static int roll_back(RollbackSession *session) {
+    long first = session->wrong;
+    long last = session->tick;
+    session->wrong = 0;
+    double start = now_seconds();
+    session->state = session->saved[first % ROLLBACK_SAVED];
+    for (long t = first; t <= last; t++) {
+        simulate(session, t);
+    }
+    session->stats.resim_ns += (uint64_t)((now_seconds() - start) * 1e9);
+
+    int depth = (int)(last - first + 1);
+    session->stats.rollbacks++;
+    session->stats.resimulated_ticks += depth;
+    if (depth > session->stats.rollback_depth_max) {
+        session->stats.rollback_depth_max = depth;
+    }
+    return depth;
+}
+
+static void receive_sync(RollbackSession *session, Packet *packet) {
+    int player = (int)get(packet, 1);
+    bool heard = get(packet, 1) != 0;
+    uint64_t seed = get(packet, 8);
+    int tick_rate = (int)get(packet, 2);
+    int width = (int)get(packet, 2);
+    int height = (int)get(packet, 2);
+    int input_delay = (int)get(packet, 1);
+    uint64_t hazards_hash = get(packet, 8);
+    if (session->connected) {
+        return;
+    }
+    if (player == session->local) {
+        session->error = "both peers are the same player";
+    } else if (tick_rate != session->tick_rate || width != session->width || height != session->height) {
+        session->error = "the peers run different tick rates or screen sizes";
+    } else if (hazards_hash != hazards.hash) {
+        session->error = "the peers have different hazards.cfg";
+    }
+    if (session->error != NULL) {
+        return;
+    }
+    // Player 0 picks the seed and input delay
+    if (session->local == 1 && (seed != session->seed || input_delay != session->input_delay)) {
+        session->seed = seed;
+        session->input_delay = input_delay;
+        start_games(session);
+    }
+    session->peer_heard = true;
+    if (heard) {
+        session->connected = true;
+    }
+}
+
+static void receive_inputs(RollbackSession *session, Packet *packet) {
+    int remote = 1 - session->local;
+    long first = (long)get(packet, 4);
+    int count = (int)get(packet, 1);
+    for (long t = first; t < first + count; t++) {
+        uint8_t bits = (uint8_t)get(packet, 1);
+        if (t != session->known[remote] + 1) {
+            continue; // Already have it, or a gap before it
+        }
+        session->inputs[remote][t & HISTORY_MASK] = bits;
+        session->known[remote] = t;
+        if (t <= session->tick && bits != session->used[t & HISTORY_MASK]) {
+            session->stats.mispredicted_ticks++;
+            if (session->wrong == 0 || t < session->wrong) {
+                session->wrong = t;
+            }
+        }
+    }
+    long acked = (long)get(packet, 4);
+    session->peer_acked = acked > session->peer_acked ? acked : session->peer_acked;
+    long peer_tick = (long)get(packet, 4);
+    int advantage = (int16_t)get(packet, 2);
+    if (peer_tick >= session->peer_tick) {
+        session->peer_tick = peer_tick;
+        session->peer_advantage = advantage;
+    }
+
+    long hash_tick = (long)get(packet, 4);
+    uint64_t hash = get(packet, 8);
+    if (hash_tick <= session->compared_tick) {
+        return; // Every packet repeats the newest hash
+    }
+    int slot = (int)(hash_tick / ROLLBACK_HASH_INTERVAL % ROLLBACK_HASHES);
+    if (session->hash_ticks[slot] == hash_tick) {
+        compare_hash(session, hash_tick, session->hashes[slot], hash);
+        session->peer_hash_tick = 0;
+    } else if (hash_tick > session->confirmed) {
+        session->peer_hash_tick = hash_tick; // Compared once ours is final
+        session->peer_hash = hash;
+    }
+}
+
+// Once per frame: exchange packets, and roll back if an input that arrived
+// proves a guess wrong. Returns whether the peers are connected.
+bool rollback_poll(RollbackSession *session, double now) {
+    session->stats.frames++;
+    net_flush(&session->link, now);
+
+    uint8_t data[NET_MAX_PACKET];
+    int size;
+    bool heard = false;
+    while ((size = net_receive(&session->link, data, sizeof(data))) > 0) {
+        Packet packet = {data, size, 0};
+        if (get(&packet, 4) != PACKET_MAGIC) {
+            continue;
+        }
+        int type = (int)get(&packet, 1);
+        if (type == PACKET_SYNC) {
+            receive_sync(session, &packet);
+            heard = true;
+        } else if (type == PACKET_INPUT) {
+            session->connected = true; // The peer only sends inputs once it heard us
+            receive_inputs(session, &packet);
+        }
+    }
+    if (session->error != NULL) {
+        return false;
+    }
+
+    if (!session->connected) {
+        if (heard || now - session->last_send >= SYNC_INTERVAL || session->last_send < 0) {
+            send_sync(session, session->peer_heard, now);
+        }
+        return false;
+    }
+
+    int resimulated = 0;
+    if (session->wrong != 0) {
+        resimulated = roll_back(session);
+    }
+    if (resimulated > session->stats.resim_max_per_frame) {
+        session->stats.resim_max_per_frame = resimulated;
+    }
+    confirm(session);
+
+    // Keep acknowledging and resending even while stalled
+    if (now - session->last_send >= session->tick_dt) {
+        send_inputs(session, now);
+    }
+    return true;
+}
+
+// Sample the local input for tick + input_delay and run the next tick.
+// Returns false if the tick was held back to wait for the peer.
+bool rollback_advance(RollbackSession *session, InputFrame input, double now) {
+    if (!session->connected || session->error != NULL) {
+        return false;
+    }
+    long next = session->tick + 1;
+    int remote = 1 - session->local;
+    if (next - session->known[remote] > ROLLBACK_MAX_PREDICTION) {
+        session->stats.stalls++;
+        return false;
+    }
+    // Running ahead of the peer makes it roll back more than us: wait a tick now and then
+    int lead = (int)((session->tick - session->peer_tick) - session->peer_advantage) / 2;
+    if (lead >= 1 && next - session->last_wait >= ROLLBACK_WAIT_SPACING) {
+        session->last_wait = next;
+        session->stats.sync_waits++;
+        return false;
+    }
+
+    long at = next + session->input_delay;
+    session->inputs[session->local][at & HISTORY_MASK] = input_bits(input);
+    session->known[session->local] = at;
+    if (next > session->known[remote]) {
+        session->stats.predicted_ticks++;
+    }
+    simulate(session, next);
+    session->stats.ticks++;
+    confirm(session);
+    send_inputs(session, now);
+    return true;
+}
+
+// Both players are out; the scores say who won
+bool rollback_match_over(const RollbackSession *session) {
+    return session->state.players[0].game_over && session->state.players[1].game_over &&
+           session->confirmed == session->tick;
+}
+
+void rollback_report(const RollbackSession *session) {
+    const RollbackStats *stats = &session->stats;
+    const NetStats *net = &session->link.stats;
+    printf("versus:         player %d, %ld ticks over %ld frames, input delay %d\n", session->local, stats->ticks,
+           stats->frames, session->input_delay);
+    printf("prediction:     %ld ticks guessed, %ld wrong; %ld stalls, %ld time sync waits\n",
+           stats->predicted_ticks, stats->mispredicted_ticks, stats->stalls, stats->sync_waits);
+    printf("rollbacks:      %ld, %.2f ticks deep on average, %ld at most\n", stats->rollbacks,
+           stats->rollbacks > 0 ? (double)stats->resimulated_ticks / stats->rollbacks : 0.0,
+           stats->rollback_depth_max);
+    printf("re-simulated:   %ld ticks, %.3f per frame, %d in one frame at most, %.1f us each\n",
+           stats->resimulated_ticks, stats->frames > 0 ? (double)stats->resimulated_ticks / stats->frames : 0.0,
+           stats->resim_max_per_frame,
+           stats->resimulated_ticks > 0 ? stats->resim_ns / 1e3 / stats->resimulated_ticks : 0.0);
+    printf("packets:        %ld sent (%ld bytes), %ld dropped, %ld received\n", net->sent, net->bytes_sent,
+           net->dropped, net->received);
+    printf("desync checks:  %ld, %ld failed", stats->hash_checks, stats->desyncs);
+    if (stats->first_desync_tick >= 0) {
+        printf(", first at tick %ld", stats->first_desync_tick);
+    }
+    printf("\n");
+}
@@ -0,0 +1,104 @@
+#ifndef ROLLBACK_H
+#define ROLLBACK_H
+
+// Two-player versus with rollback netcode. Both players run the same
+// survival game, from the same seed, side by side; whoever survives longer
+// wins. Each peer simulates both games and only inputs cross the network.
+//
+// The remote player's input for a tick is usually not here yet when the
+// tick runs, so it is predicted: held keys stay held and jumps are not
+// guessed. When the real input arrives and differs, the state saved before
+// that tick is restored and the ticks since are simulated again with it.
+// Local inputs run input_delay ticks after they are sampled, which hides
+// that much latency without any rollback. The simulation never runs more
+// than ROLLBACK_MAX_PREDICTION ticks past the newest remote input; beyond
+// that it stalls until the peer catches up.
+//
+// Packets carry every local input the peer has not acknowledged, so lost
+// packets cost nothing until the loss outlasts the prediction window. Every
+// ROLLBACK_HASH_INTERVAL ticks both peers hash the final state and compare,
+// so a desync is reported at the tick it becomes visible.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sim.h"
+#include "net.h"
+
+#define ROLLBACK_MAX_PREDICTION 8
+#define ROLLBACK_SAVED (ROLLBACK_MAX_PREDICTION + 2) // States kept to roll back to
+#define ROLLBACK_HISTORY 128 // Ticks of input kept, a power of two
+#define ROLLBACK_MAX_RESEND 64 // Unacknowledged inputs sent per packet, at most
+#define ROLLBACK_DEFAULT_DELAY 2
+#define ROLLBACK_HASH_INTERVAL 30
+#define ROLLBACK_HASHES 8 // Recent local hashes kept to compare with the peer's
+#define ROLLBACK_WAIT_SPACING 30 // Ticks between time sync waits
+
+typedef struct {
+    GameState players[2];
+} VersusState;
+
+typedef struct {
+    long frames;              // rollback_poll() calls
+    long ticks;               // Ticks advanced, not counting re-simulation
+    long stalls;              // Ticks held back by the prediction limit
+    long sync_waits;          // Ticks held back so a peer that is behind can catch up
+    long predicted_ticks;     // Ticks first simulated with a guessed remote input
+    long mispredicted_ticks;  // Guesses the real input proved wrong
+    long rollbacks;
+    long rollback_depth_max;  // Ticks re-simulated by the deepest rollback
+    long resimulated_ticks;
+    int resim_max_per_frame;
+    uint64_t resim_ns;        // Time spent re-simulating
+    long hash_checks;         // Ticks whose hash both peers compared
+    long desyncs;
+    long first_desync_tick;   // -1 if none
+} RollbackStats;
+
+typedef struct {
+    NetLink link; // Opened by the caller after rollback_init()
+    int local;    // This peer's player, 0 or 1
+    int input_delay;
+    int tick_rate;
+    float tick_dt;
+    int width;
+    int height;
+    uint64_t seed; // Player 0's, adopted by player 1 when they connect
+    bool peer_heard; // Got the peer's hello
+    bool connected;
+    const char *error; // Why the peers cannot play together, or NULL
+    double last_send;
+
+    VersusState state; // After tick
+    long tick;
+    VersusState saved[ROLLBACK_SAVED]; // saved[t % ROLLBACK_SAVED] is the state before tick t
+
+    uint8_t inputs[2][ROLLBACK_HISTORY]; // input_bits() per tick, indexed by tick % ROLLBACK_HISTORY
+    uint8_t used[ROLLBACK_HISTORY];      // Remote input each simulated tick ran with
+    long known[2];     // Newest tick each player's input is known for
+    long peer_acked;   // Newest local input the peer has
+    long wrong;        // Earliest tick simulated with a wrong guess, 0 if none
+    long confirmed;    // Every input up to this tick was real, so its state is final
+
+    long peer_tick;     // The peer's tick when it sent its newest packet
+    int peer_advantage; // How far that was ahead of the newest tick it had from us
+    long last_wait;
+
+    long hash_ticks[ROLLBACK_HASHES];
+    uint64_t hashes[ROLLBACK_HASHES];
+    long peer_hash_tick; // Newest hash the peer sent that is not compared yet, 0 if none
+    uint64_t peer_hash;
+    long compared_tick;  // Newest tick whose hashes were compared
+
+    RollbackStats stats;
+} RollbackSession;
+
+void rollback_init(RollbackSession *session, int player, uint64_t seed, int tick_rate, int width, int height,
+                   int input_delay);
+bool rollback_poll(RollbackSession *session, double now);
+bool rollback_advance(RollbackSession *session, InputFrame input, double now);
+bool rollback_match_over(const RollbackSession *session);
+uint64_t versus_hash(const VersusState *state);
+void rollback_report(const RollbackSession *session);
+
+#endif
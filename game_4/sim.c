@@ -0,0 +1,521 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "sim.h"
+#include "collision.h"
+#include "profiler.h"
+
+// The four keys of an input in the low bits of a byte, for recordings and the network
+uint8_t input_bits(InputFrame input) {
+    return input.left | input.right << 1 | input.down << 2 | input.jump << 3;
+}
+
+InputFrame input_from_bits(uint8_t bits) {
+    return (InputFrame){
+        .left = bits & 1,
+        .right = (bits >> 1) & 1,
+        .down = (bits >> 2) & 1,
+        .jump = (bits >> 3) & 1,
+    };
+}
+
+// Same test as raylib's CheckCollisionRecs
+bool check_collision_rects(SimRect a, SimRect b) {
+    return a.x < b.x + b.width && a.x + a.width > b.x &&
+           a.y < b.y + b.height && a.y + a.height > b.y;
+}
+
+// What a timer does when it fires
+typedef enum {
+    EVENT_SCORE,     // One more point
+    EVENT_WAVE,      // A hazard's wave starts; arg is the hazard type
+    EVENT_WAVE_NEXT, // The next projectile of a wave
+    EVENT_RAMP,      // A hazard's waves come more often
+} SimEvent;
+
+// Spawn a projectile of a hazard type at the height its spawn pattern picks.
+// Returns its pool slot, or -1 when the pool is full.
+int spawn_projectile(GameState *state, int hazard, float x) {
+    const HazardType *type = &hazards.types[hazard];
+    int floor_y = state->height - state->floor_piece_height + state->floor_spacing;
+    int lowest = floor_y - projectile_types[type->sprite].height; // Resting on the floor
+    int y;
+    switch (type->spawn) {
+    case SPAWN_FLOOR:
+        y = lowest;
+        break;
+    case SPAWN_AIMED:
+        y = state->character.y + (state->character.height_stand - projectile_types[type->sprite].height) / 2;
+        y = y < 0 ? 0 : y > lowest ? lowest : y;
+        break;
+    default:
+        y = rng_range(&state->rng[RNG_SPAWN], lowest); // Random y position above the floor
+        break;
+    }
+    return projectile_spawn(&state->projectiles, hazard, x, y, hazard_speed(type, state->score));
+}
+
+// Function to check if the character is colliding with any platform.
+// While falling, the feet strip is swept down from where it was at the
+// previous tick, so a fast fall cannot skip a platform. Returns the
+// platform whose top the feet reached first, ties going to floor pieces
+// and then to the leftmost, or NULL.
+const Platform *character_on_platform(Character character, const World *world) {
+    SimRect character_rec = {.x = character.x + 10, .y = character.y + character.height_stand - character.height_stand * 0.2,
+                             .width = character.width - 15, .height = character.height_stand* 0.2 + 1};
+    float fall = character.y - character.prev_y;
+    if (fall > 0) {
+        character_rec.y -= fall;
+        character_rec.height += fall;
+    }
+    float previous_feet = character.prev_y + character.height_stand;
+
+    // Only platforms under the character's feet can collide
+    const Platform *candidates[16];
+    int candidate_count = world_query(world, character_rec.x, character_rec.x + character_rec.width, candidates, 16);
+
+    const Platform *found = NULL;
+    float found_time = 0;
+    for (int c = 0; c < candidate_count; c++) {
+        const Platform *platform = candidates[c];
+        SimRect platform_rec = {.x = platform->x, .y = platform->y, .width = platform->width, .height = platform->height};
+        if (!check_collision_rects(character_rec, platform_rec)) {
+            continue;
+        }
+
+        // Fraction of the fall at which the feet reached the top, 0 if they already had
+        float time = fall > 0 ? (platform->y - previous_feet) / fall : 0;
+        time = time > 0 ? time : 0;
+        if (found == NULL || time < found_time ||
+            (time == found_time && ((platform->type == FLOOR && found->type != FLOOR) ||
+                                    (platform->type == found->type && platform->x < found->x)))) {
+            found = platform;
+            found_time = time;
+        }
+    }
+    return found;
+}
+
+CharacterPose character_pose(const Character *character) {
+    if (character->crouching) {
+        return POSE_CROUCHING;
+    }
+    if (character->jumping) {
+        return POSE_JUMPING;
+    }
+    if (character->walking) {
+        return (int)(character->walk_time * CHARACTER_WALK_FRAME_RATE) % 2 == 0 ? POSE_WALK1 : POSE_WALK2;
+    }
+    return POSE_STANDING;
+}
+
+// The mask of the sprite drawn for the character's pose and direction
+HitMaskId character_hitmask(const Character *character) {
+    static const HitMaskId masks[][2] = {
+        [POSE_STANDING] = {HITMASK_STANDING_LEFT, HITMASK_STANDING_RIGHT},
+        [POSE_WALK1] = {HITMASK_WALK1_LEFT, HITMASK_WALK1_RIGHT},
+        [POSE_WALK2] = {HITMASK_WALK2_LEFT, HITMASK_WALK2_RIGHT},
+        [POSE_JUMPING] = {HITMASK_JUMPING_LEFT, HITMASK_JUMPING_RIGHT},
+        [POSE_CROUCHING] = {HITMASK_CROUCHING_LEFT, HITMASK_CROUCHING_RIGHT},
+    };
+    return masks[character_pose(character)][character->direction == -1 ? 0 : 1];
+}
+
+bool check_character_collision(Character character, const ProjectilePool *projectiles) {
+    // The mask sits where the sprite is drawn
+    const HitMask *mask = &hitmasks[character_hitmask(&character)];
+    float y = character.y + (character.crouching ? CHARACTER_CROUCH_DROP : 0);
+
+    // Check collision with arrows and swords along the path both took this tick
+    float time;
+    return projectile_first_swept_hit(projectiles, mask, character.x, y, character.x - character.prev_x,
+                                      character.y - character.prev_y, &time) != -1;
+}
+
+void game_init(GameState *state, int width, int height, uint64_t seed) {
+    memset(state, 0, sizeof(*state));
+    state->seed = seed;
+    for (int stream = 0; stream < RNG_STREAM_COUNT; stream++) {
+        rng_seed(&state->rng[stream], seed, stream);
+    }
+    state->width = width;
+    state->height = height;
+
+    // Initialize character properties
+    state->character = (Character){.x = width / 2,
+                                   .y = height / 2,
+                                   .width = 101,
+                                   .height_stand = 260,
+                                   .height_crouch = 130,
+                                   .velocity = 4 * scale_factor * 60,
+                                   .direction = 1,
+                                   .speed = 7 * scale_factor * 60,
+                                   .jumping = false,
+                                   .walking = false,};
+
+    state->character.prev_x = state->character.x;
+    state->character.prev_y = state->character.y;
+
+    // Initialize gravity, 2.3 * scale_factor pixels per frame at 60 FPS
+    state->gravity = 2.3 * scale_factor * 60 * 60;
+
+    // The world is generated chunk by chunk as the camera moves
+    state->floor_piece_height = FLOOR_PIECE_HEIGHT;
+    state->floor_spacing = FLOOR_SPACING;
+    uint64_t world_seed = rng_next(&state->rng[RNG_WORLD]);
+    world_seed = world_seed << 32 | rng_next(&state->rng[RNG_WORLD]);
+    world_init(&state->world, world_seed, width, height);
+    world_stream(&state->world, 0, width);
+
+    projectile_pool_init(&state->projectiles);
+    collision_init();
+    hazards_init();
+
+    // Timers are scheduled in ticks, from the first tick, when the tick length is known
+    timers_init(&state->timers);
+    state->score_interval = 1.3f; // Interval in seconds
+}
+
+void game_snapshot(const GameState *state, GameSnapshot *snapshot) {
+    memcpy(&snapshot->state, state, sizeof(*state));
+}
+
+void game_restore(GameState *state, const GameSnapshot *snapshot) {
+    memcpy(state, &snapshot->state, sizeof(*state));
+}
+
+// Copy out what drawing needs. Platforms are taken for both camera positions
+// the frame can interpolate between, widened by the 20 px floor pieces are
+// drawn left of their platform.
+void game_render_view(const GameState *state, RenderView *view) {
+    view->width = state->width;
+    view->height = state->height;
+    view->character = state->character;
+    view->camera_x = state->camera_x;
+    view->prev_camera_x = state->prev_camera_x;
+    view->floor_spacing = state->floor_spacing;
+    view->score = state->score;
+    view->game_over = state->game_over;
+
+    float left = -fmaxf(state->camera_x, state->prev_camera_x);
+    float right = -fminf(state->camera_x, state->prev_camera_x) + state->width + 20;
+    const Platform *visible[RENDER_VIEW_PLATFORMS];
+    view->platform_count = world_query(&state->world, left, right, visible, RENDER_VIEW_PLATFORMS);
+    for (int i = 0; i < view->platform_count; i++) {
+        view->platforms[i] = *visible[i];
+    }
+    view->resident_platforms = 0;
+    for (int c = 0; c < WORLD_CHUNK_RING; c++) {
+        if (state->world.chunks[c].index != WORLD_NO_CHUNK) {
+            view->resident_platforms += state->world.chunks[c].platform_count;
+        }
+    }
+
+    const ProjectilePool *pool = &state->projectiles;
+    int count = 0;
+    for (int i = 0; i < pool->high_water; i++) {
+        if (pool->hazard[i] != PROJECTILE_NONE) {
+            view->projectiles[count++] = (ViewProjectile){pool->x[i], pool->prev_x[i], pool->y[i], pool->hazard[i]};
+        }
+    }
+    view->projectile_count = count;
+}
+
+// game_step() phases. Each one is public so benchmarks and profilers can
+// time them separately; game_step() is the only caller in the game.
+
+// Save previous positions, advance timers and move the camera
+void step_begin(GameState *state) {
+    Character *character = &state->character;
+    int width = state->width;
+
+    character->prev_x = character->x;
+    character->prev_y = character->y;
+    state->prev_camera_x = state->camera_x;
+    state->tick++;
+
+    character->walking = false;
+    character->crouching = false; // Reset crouching state
+
+    if (character->x > width * 0.6) {
+        state->camera_x = -(character->x - width * 0.6);
+    } else if (character->x < width * 0.4) {
+        state->camera_x = -(character->x - width * 0.6);
+    }
+
+    if (state->camera_x > 0) {
+        state->camera_x = 0;
+    }
+
+    world_stream(&state->world, -state->camera_x, -state->camera_x + width);
+}
+
+// Update character's position and velocity
+void step_physics(GameState *state, float delta_time) {
+    Character *character = &state->character;
+    character->y += character->velocity * delta_time;
+    character->velocity += state->gravity * delta_time;
+}
+
+// Land on a platform and jump from it
+void step_platforms(GameState *state, InputFrame input) {
+    Character *character = &state->character;
+
+    // Check if character is on any platform
+    const Platform *current_platform = character_on_platform(*character, &state->world);
+    if (current_platform != NULL) {
+        if (character->velocity > 0) {
+            character->velocity = 0;
+            character->y = current_platform->y - character->height_stand;
+            character->jumping = false;
+        }
+        // Jump if space is pressed
+        if (input.jump) {
+            character->velocity = -30 * scale_factor * 60; // Negative velocity to make the character jump
+            character->jumping = true;
+        }
+    }
+}
+
+// Walk and crouch
+void step_movement(GameState *state, InputFrame input, float delta_time) {
+    Character *character = &state->character;
+
+    // Move the character
+    if (input.left) {
+        character->walking = true;
+        character->x -= character->speed * delta_time;
+        character->direction = -1;
+    }
+
+    if (input.right) {
+        character->walking = true;
+        character->x += character->speed * delta_time;
+        character->direction = 1;
+    }
+
+    if (character->walking) {
+        character->walk_time += delta_time;
+    }
+
+    // Crouch the character
+    if (input.down) {
+        character->crouching = true;
+    }
+}
+
+// Whole ticks until seconds have passed, at least one
+static int32_t seconds_to_ticks(float seconds, float delta_time) {
+    int32_t ticks = (int32_t)ceilf(seconds / delta_time - 0.001f);
+    return ticks > 1 ? ticks : 1;
+}
+
+// At most one score tick plus a wave, wave-next and ramp timer per hazard
+// are pending, so scheduling never fails and its result is not checked
+_Static_assert(TIMER_CAPACITY >= 3 * HAZARD_MAX_TYPES + 1, "TIMER_CAPACITY too small for HAZARD_MAX_TYPES");
+
+static void schedule(GameState *state, float seconds, SimEvent event, int arg, float delta_time) {
+    timers_schedule(&state->timers, state->timers.now + seconds_to_ticks(seconds, delta_time), event, arg);
+}
+
+// First score tick, and every hazard's first wave and ramp
+static void start_timers(GameState *state, float delta_time) {
+    schedule(state, state->score_interval, EVENT_SCORE, 0, delta_time);
+    for (int h = 0; h < hazards.count; h++) {
+        const HazardType *type = &hazards.types[h];
+        state->hazard_state[h] = (HazardState){.interval = type->interval};
+        schedule(state, type->first, EVENT_WAVE, h, delta_time);
+        if (type->ramp_every > 0) {
+            schedule(state, type->ramp_every, EVENT_RAMP, h, delta_time);
+        }
+    }
+}
+
+// Whether reaching score changes some hazard's speed
+static bool speeds_change_at(int score) {
+    for (int h = 0; h < hazards.count; h++) {
+        if (hazards.types[h].speed_gain != 0 && score % hazards.types[h].speed_step == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fire the timers due this tick: hazard waves spawn at the right edge of
+// the screen, the score goes up and hazards ramp up
+void step_spawn(GameState *state, float delta_time) {
+    if (state->tick == 1) {
+        start_timers(state, delta_time);
+    }
+    int rightmost_x = state->width - state->camera_x;
+
+    timers_advance(&state->timers, state->tick);
+    Timer timer;
+    while (timers_pop(&state->timers, &timer)) {
+        int h = timer.arg;
+        const HazardType *type = &hazards.types[h];
+        HazardState *hazard = &state->hazard_state[h];
+        switch (timer.event) {
+        case EVENT_SCORE:
+            state->score++;
+            if (speeds_change_at(state->score)) {
+                projectile_set_speeds(&state->projectiles, state->score);
+            }
+            schedule(state, state->score_interval, EVENT_SCORE, 0, delta_time);
+            break;
+        case EVENT_WAVE:
+            if (state->score >= type->min_score) {
+                // A wave still going on is topped up rather than given a second timer
+                bool idle = hazard->wave_left == 0;
+                hazard->wave_left = type->wave_count;
+                if (idle) {
+                    spawn_projectile(state, h, rightmost_x);
+                    if (--hazard->wave_left > 0) {
+                        schedule(state, type->wave_gap, EVENT_WAVE_NEXT, h, delta_time);
+                    }
+                }
+            }
+            schedule(state, hazard->interval, EVENT_WAVE, h, delta_time);
+            break;
+        case EVENT_WAVE_NEXT:
+            spawn_projectile(state, h, rightmost_x);
+            if (--hazard->wave_left > 0) {
+                schedule(state, type->wave_gap, EVENT_WAVE_NEXT, h, delta_time);
+            }
+            break;
+        case EVENT_RAMP:
+            hazard->interval *= type->ramp_factor;
+            hazard->interval = hazard->interval > type->ramp_min ? hazard->interval : type->ramp_min;
+            schedule(state, type->ramp_every, EVENT_RAMP, h, delta_time);
+            break;
+        }
+    }
+}
+
+// Move projectiles and drop the ones that left the screen on the left
+void step_projectiles(GameState *state, float delta_time) {
+    update_projectiles(&state->projectiles, -state->camera_x, delta_time);
+}
+
+void step_collision(GameState *state) {
+    state->game_over = check_character_collision(state->character, &state->projectiles);
+}
+
+// Keep the character inside the world, which is endless to the right only
+void step_end(GameState *state) {
+    Character *character = &state->character;
+    if (character->x < 0) {
+        character->x = 0;
+    }
+}
+
+// Advance the simulation by one tick of delta_time seconds (the SimClock tick length)
+void game_step(GameState *state, InputFrame input, float delta_time) {
+    step_begin(state);
+
+    if (!state->game_over) {
+        PROFILE_BEGIN(ZONE_PHYSICS);
+        step_physics(state, delta_time);
+        PROFILE_END(ZONE_PHYSICS);
+
+        PROFILE_BEGIN(ZONE_PLATFORMS);
+        step_platforms(state, input);
+        PROFILE_END(ZONE_PLATFORMS);
+
+        step_movement(state, input, delta_time);
+
+        PROFILE_BEGIN(ZONE_SPAWN);
+        step_spawn(state, delta_time);
+        PROFILE_END(ZONE_SPAWN);
+
+        PROFILE_BEGIN(ZONE_PROJECTILES);
+        step_projectiles(state, delta_time);
+        PROFILE_END(ZONE_PROJECTILES);
+
+        PROFILE_BEGIN(ZONE_COLLISION);
+        step_collision(state);
+        PROFILE_END(ZONE_COLLISION);
+    }
+
+    step_end(state);
+}
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// FNV-1a over everything a tick can change, field by field so struct
+// padding never counts. Equal hashes after the same inputs mean the
+// simulation stayed deterministic.
+uint64_t game_state_hash(const GameState *state) {
+    const Character *character = &state->character;
+    const ProjectilePool *pool = &state->projectiles;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    hash = hash_bytes(hash, &character->x, sizeof(character->x));
+    hash = hash_bytes(hash, &character->y, sizeof(character->y));
+    hash = hash_bytes(hash, &character->velocity, sizeof(character->velocity));
+    hash = hash_bytes(hash, &character->direction, sizeof(character->direction));
+    hash = hash_bytes(hash, &character->walk_time, sizeof(character->walk_time));
+    hash = hash_bytes(hash, &state->camera_x, sizeof(state->camera_x));
+    hash = hash_bytes(hash, &state->tick, sizeof(state->tick));
+    hash = hash_bytes(hash, &state->score, sizeof(state->score));
+    hash = hash_bytes(hash, &state->game_over, sizeof(state->game_over));
+    hash = hash_bytes(hash, &hazards.hash, sizeof(hazards.hash));
+    for (int h = 0; h < hazards.count; h++) {
+        hash = hash_bytes(hash, &state->hazard_state[h].interval, sizeof(state->hazard_state[h].interval));
+        hash = hash_bytes(hash, &state->hazard_state[h].wave_left, sizeof(state->hazard_state[h].wave_left));
+    }
+    const TimerWheel *timers = &state->timers;
+    hash = hash_bytes(hash, &timers->now, sizeof(timers->now));
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            for (int t = timers->slots[level][slot]; t != TIMER_NONE; t = timers->timers[t].next) {
+                hash = hash_bytes(hash, &timers->timers[t].due, sizeof(timers->timers[t].due));
+                hash = hash_bytes(hash, &timers->timers[t].event, sizeof(timers->timers[t].event));
+                hash = hash_bytes(hash, &timers->timers[t].arg, sizeof(timers->timers[t].arg));
+            }
+        }
+    }
+    for (int stream = 0; stream < RNG_STREAM_COUNT; stream++) {
+        hash = hash_bytes(hash, &state->rng[stream].state, sizeof(state->rng[stream].state));
+    }
+    for (int i = 0; i < pool->high_water; i++) {
+        if (pool->hazard[i] != PROJECTILE_NONE) {
+            hash = hash_bytes(hash, &pool->hazard[i], sizeof(pool->hazard[i]));
+            hash = hash_bytes(hash, &pool->x[i], sizeof(pool->x[i]));
+            hash = hash_bytes(hash, &pool->y[i], sizeof(pool->y[i]));
+        }
+    }
+    return hash;
+}
+
+void sim_clock_init(SimClock *clock, int tick_rate) {
+    clock->tick_dt = 1.0f / tick_rate;
+    clock->accumulator = 0.0f;
+}
+
+// Add a rendered frame's duration and return how many ticks to simulate.
+// Long stalls are capped at SIM_MAX_TICKS_PER_FRAME so a slow machine
+// falls behind real time instead of spiralling.
+int sim_clock_advance(SimClock *clock, float frame_time) {
+    clock->accumulator += frame_time;
+    int ticks = (int)(clock->accumulator / clock->tick_dt);
+    if (ticks > SIM_MAX_TICKS_PER_FRAME) {
+        ticks = SIM_MAX_TICKS_PER_FRAME;
+        clock->accumulator = 0.0f;
+    } else {
+        clock->accumulator -= ticks * clock->tick_dt;
+    }
+    return ticks;
+}
+
+// How far between the previous and the current tick the frame is drawn, 0..1
+float sim_clock_alpha(const SimClock *clock) {
+    return clock->accumulator / clock->tick_dt;
+}
@@ -0,0 +1,172 @@
+#ifndef SIM_H
+#define SIM_H
+
+// Game simulation: all state and update logic, no raylib calls.
+// Used by the windowed game (game.c) and the headless tools (tools/).
+
+#include <stdbool.h>
+
+#include "projectile.h"
+#include "world.h"
+#include "rng.h"
+#include "hitmask.h"
+#include "hazard.h"
+#include "timers.h"
+
+#define scale_factor 1.5
+
+// Default simulation rate. Speeds are in pixels per second so the tick
+// rate can be changed without changing gameplay.
+#define SIM_TICK_RATE 60
+#define SIM_MAX_TICKS_PER_FRAME 8
+
+#define CHARACTER_CROUCH_DROP 135 // The crouch sprite is drawn this far below the standing one, feet level
+#define CHARACTER_WALK_FRAME_RATE 5 // Walk animation frames per second
+
+// What the character is doing; picks both the sprite drawn and the hitmask hit
+typedef enum {
+    POSE_STANDING,
+    POSE_WALK1,
+    POSE_WALK2,
+    POSE_JUMPING,
+    POSE_CROUCHING,
+} CharacterPose;
+
+// Character Parameters
+typedef struct {
+    float x;
+    float y;
+    float prev_x; // Position at the previous tick, for render interpolation
+    float prev_y;
+    int width;
+    int height_stand;
+    int height_crouch;
+    float velocity; // Pixels per second, positive is down
+    int direction;
+    float speed; // Pixels per second
+    bool jumping;
+    bool walking;
+    bool crouching; // Add crouching state
+    float walk_time; // Seconds spent walking, drives the walk animation
+} Character;
+
+// Axis aligned box, same layout as raylib's Rectangle
+typedef struct {
+    float x;
+    float y;
+    float width;
+    float height;
+} SimRect;
+
+// Player input for one update
+typedef struct {
+    bool left;  // KEY_LEFT held
+    bool right; // KEY_RIGHT held
+    bool down;  // KEY_DOWN held
+    bool jump;  // KEY_SPACE pressed this frame
+} InputFrame;
+
+// Everything the game loop updates
+typedef struct {
+    int width;  // Screen width
+    int height; // Screen height
+
+    Character character;
+    float gravity; // Pixels per second squared
+    float camera_x; // camera.offset.x, always <= 0
+    float prev_camera_x;
+    long tick;
+
+    uint64_t seed; // Everything random in a run follows from this
+    Rng rng[RNG_STREAM_COUNT];
+
+    World world;
+    int floor_piece_height;
+    int floor_spacing;
+
+    ProjectilePool projectiles;
+
+    // Hazard waves, score ticks and difficulty ramps, fired by step_spawn()
+    TimerWheel timers;
+    HazardState hazard_state[HAZARD_MAX_TYPES]; // Indexed like hazards.types
+
+    int score;
+    float score_interval; // Seconds per point
+
+    bool game_over;
+} GameState;
+
+// A whole GameState, saved and restored with one memcpy. GameState holds no
+// pointers (the world, projectile pool and RNG streams are embedded), so a
+// snapshot can be restored into any GameState or written out as bytes.
+typedef struct {
+    GameState state;
+} GameSnapshot;
+
+#define RENDER_VIEW_PLATFORMS 256
+
+typedef struct {
+    float x;
+    float prev_x;
+    float y;
+    uint8_t hazard; // Index into hazards.types
+} ViewProjectile;
+
+// What drawing a tick needs, filled by game_render_view(): the live
+// projectiles in slot order and the platforms near the screen, copied out
+// so the renderer can keep it while the game moves on. A few KB against
+// the whole GameState's pools, world chunks and timers.
+typedef struct {
+    int width;
+    int height;
+    Character character;
+    float camera_x;
+    float prev_camera_x;
+    int floor_spacing;
+    int score;
+    bool game_over;
+    int resident_platforms; // In all resident chunks, for the culling counters
+    int platform_count;
+    Platform platforms[RENDER_VIEW_PLATFORMS];
+    int projectile_count;
+    ViewProjectile projectiles[MAX_PROJECTILES];
+} RenderView;
+
+// Fixed timestep driver: turns variable frame times into whole ticks
+typedef struct {
+    float tick_dt;
+    float accumulator;
+} SimClock;
+
+void game_init(GameState *state, int width, int height, uint64_t seed);
+void game_step(GameState *state, InputFrame input, float dt);
+void game_snapshot(const GameState *state, GameSnapshot *snapshot);
+void game_restore(GameState *state, const GameSnapshot *snapshot);
+uint64_t game_state_hash(const GameState *state);
+void game_render_view(const GameState *state, RenderView *view);
+
+// Phases of game_step(), in the order it runs them
+void step_begin(GameState *state);
+void step_physics(GameState *state, float dt);
+void step_platforms(GameState *state, InputFrame input);
+void step_movement(GameState *state, InputFrame input, float dt);
+void step_spawn(GameState *state, float dt);
+void step_projectiles(GameState *state, float dt);
+void step_collision(GameState *state);
+void step_end(GameState *state);
+
+uint8_t input_bits(InputFrame input);
+InputFrame input_from_bits(uint8_t bits);
+
+void sim_clock_init(SimClock *clock, int tick_rate);
+int sim_clock_advance(SimClock *clock, float frame_time);
+float sim_clock_alpha(const SimClock *clock);
+
+bool check_collision_rects(SimRect a, SimRect b);
+int spawn_projectile(GameState *state, int hazard, float x);
+const Platform *character_on_platform(Character character, const World *world);
+CharacterPose character_pose(const Character *character);
+HitMaskId character_hitmask(const Character *character);
+bool check_character_collision(Character character, const ProjectilePool *projectiles);
+
+#endif
@@ -0,0 +1,105 @@
+#include <string.h>
+
+#include "timers.h"
+
+#define SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+#define WHEEL_SPAN (1u << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS))
+
+void timers_init(TimerWheel *wheel) {
+    memset(wheel->slots, 0xFF, sizeof(wheel->slots));
+    for (int i = 0; i < TIMER_CAPACITY; i++) {
+        wheel->timers[i].next = i + 1 < TIMER_CAPACITY ? i + 1 : TIMER_NONE;
+    }
+    wheel->free_head = 0;
+    wheel->expired = TIMER_NONE;
+    wheel->now = 0;
+    wheel->count = 0;
+}
+
+// Link a timer into the slot of the lowest level that spans its delay. A
+// delay past the whole wheel is parked in the furthest top level slot and
+// placed again when that slot cascades.
+static void insert(TimerWheel *wheel, uint16_t index) {
+    Timer *timer = &wheel->timers[index];
+    uint32_t delay = (uint32_t)(timer->due - wheel->now);
+    uint32_t at = delay < WHEEL_SPAN ? (uint32_t)timer->due : (uint32_t)wheel->now + WHEEL_SPAN - 1;
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delay >= 1u << (TIMER_WHEEL_BITS * (level + 1))) {
+        level++;
+    }
+    uint16_t *slot = &wheel->slots[level][(at >> (TIMER_WHEEL_BITS * level)) & SLOT_MASK];
+    timer->next = *slot;
+    *slot = index;
+}
+
+// Returns false when all TIMER_CAPACITY timers are pending. A due tick
+// already reached fires on the next one.
+bool timers_schedule(TimerWheel *wheel, int32_t due, uint8_t event, uint8_t arg) {
+    uint16_t index = wheel->free_head;
+    if (index == TIMER_NONE) {
+        return false;
+    }
+    Timer *timer = &wheel->timers[index];
+    wheel->free_head = timer->next;
+    timer->due = due > wheel->now ? due : wheel->now + 1;
+    timer->event = event;
+    timer->arg = arg;
+    insert(wheel, index);
+    wheel->count++;
+    return true;
+}
+
+// Empty a slot, placing each of its timers again relative to now
+static void cascade(TimerWheel *wheel, int level, int slot) {
+    uint16_t index = wheel->slots[level][slot];
+    wheel->slots[level][slot] = TIMER_NONE;
+    while (index != TIMER_NONE) {
+        uint16_t next = wheel->timers[index].next;
+        insert(wheel, index);
+        index = next;
+    }
+}
+
+// Move the wheel on to tick, one tick at a time, collecting the timers due
+// on the way for timers_pop()
+void timers_advance(TimerWheel *wheel, int32_t tick) {
+    while (wheel->now < tick) {
+        uint32_t now = (uint32_t)++wheel->now;
+
+        // Higher level slots starting at this tick hand their timers down, highest first
+        for (int level = TIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+            int shift = TIMER_WHEEL_BITS * level;
+            if ((now & ((1u << shift) - 1)) == 0) {
+                cascade(wheel, level, (now >> shift) & SLOT_MASK);
+            }
+        }
+
+        uint16_t index = wheel->slots[0][now & SLOT_MASK];
+        wheel->slots[0][now & SLOT_MASK] = TIMER_NONE;
+        while (index != TIMER_NONE) {
+            Timer *timer = &wheel->timers[index];
+            uint16_t next = timer->next;
+            if (timer->due > wheel->now) {
+                insert(wheel, index); // Parked past the wheel's span, not due yet
+            } else {
+                timer->next = wheel->expired;
+                wheel->expired = index;
+            }
+            index = next;
+        }
+    }
+}
+
+// Take the next timer that came due, or return false when there are none
+bool timers_pop(TimerWheel *wheel, Timer *timer) {
+    uint16_t index = wheel->expired;
+    if (index == TIMER_NONE) {
+        return false;
+    }
+    *timer = wheel->timers[index];
+    wheel->expired = timer->next;
+    wheel->timers[index].next = wheel->free_head;
+    wheel->free_head = index;
+    wheel->count--;
+    return true;
+}
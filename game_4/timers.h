@@ -0,0 +1,44 @@
+#ifndef TIMERS_H
+#define TIMERS_H
+
+// Hierarchical timer wheel counting simulation ticks. Level k has 64 slots
+// of 64^k ticks each; a timer sits in the lowest level whose span covers
+// its delay, and when the wheel reaches a higher level slot its timers are
+// redistributed (cascaded) one level down. Scheduling and firing are O(1)
+// and a tick only visits one slot per level, so the cost per tick stays the
+// same however many timers are pending.
+//
+// Timers live in a fixed array linked by index, so a TimerWheel holds no
+// pointers and is copied with the GameState it belongs to.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS 4 // 64^4 ticks, over three days at 60 Hz; longer delays fire late-checked
+#define TIMER_CAPACITY 768
+#define TIMER_NONE 0xFFFF
+
+typedef struct {
+    int32_t due;   // Tick it fires at
+    uint16_t next; // Next timer in the same slot or free list, TIMER_NONE ends it
+    uint8_t event; // Meaning is up to the caller
+    uint8_t arg;
+} Timer;
+
+typedef struct {
+    Timer timers[TIMER_CAPACITY];
+    uint16_t slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS]; // First timer of each slot
+    uint16_t free_head;
+    uint16_t expired; // Timers due at now, not popped yet
+    int32_t now;      // Last tick advanced to
+    int count;        // Pending timers, expired ones included
+} TimerWheel;
+
+void timers_init(TimerWheel *wheel);
+bool timers_schedule(TimerWheel *wheel, int32_t due, uint8_t event, uint8_t arg);
+void timers_advance(TimerWheel *wheel, int32_t tick);
+bool timers_pop(TimerWheel *wheel, Timer *timer);
+
+#endif
@@ -0,0 +1,146 @@
+// Batch simulation runner: steps many independent games at once on a
+// work-stealing job pool, the way a bot or tuning script would, with random
+// actions, and reports instance-steps per second.
+//
+//   ./batch [--instances N] [--ticks T] [--threads K] [--seed N] [--sweep]
+//
+// --threads counts worker threads besides the main one (default: one per
+// extra core). --sweep repeats the run with 0, 1, 2, 4, ... workers and then
+// --threads itself, and checks every run ends in the same states, since results
+// must not depend on how instances were scheduled.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "jobs.h"
+#include "batch_env.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef struct {
+    double elapsed;
+    long steals;
+    long episodes;
+    double reward;
+    uint64_t hash; // Of every instance's final state
+} BatchResult;
+
+static BatchResult run_batch(int instances, long ticks, int threads, uint64_t seed) {
+    JobPool jobs;
+    jobs_init(&jobs, threads);
+    BatchEnv batch;
+    if (!batch_init(&batch, instances, seed, &jobs)) {
+        fprintf(stderr, "batch: no memory for %d instances\n", instances);
+        exit(1);
+    }
+
+    // Actions are drawn on the main thread so they are the same for any thread
+    // count, from streams the games themselves never use
+    Rng *action_rng = (Rng *)malloc(instances * sizeof(Rng));
+    InputFrame *actions = (InputFrame *)malloc(instances * sizeof(InputFrame));
+    for (int i = 0; i < instances; i++) {
+        rng_seed(&action_rng[i], seed, RNG_STREAM_COUNT + i);
+    }
+
+    BatchResult result = {0};
+    double start = now_seconds();
+    for (long tick = 0; tick < ticks; tick++) {
+        for (int i = 0; i < instances; i++) {
+            uint32_t bits = rng_next(&action_rng[i]);
+            actions[i] = (InputFrame){
+                .left = (bits & 3) == 0,
+                .right = (bits & 3) >= 2,
+                .down = (bits & 0x70) == 0,
+                .jump = (bits & 0x780) == 0,
+            };
+        }
+        batch_step(&batch, actions);
+        for (int i = 0; i < instances; i++) {
+            result.reward += batch.rewards[i];
+        }
+    }
+    result.elapsed = now_seconds() - start;
+    result.steals = jobs.steals;
+
+    result.hash = 14695981039346656037ULL;
+    for (int i = 0; i < instances; i++) {
+        result.episodes += batch.episodes[i];
+        result.hash = (result.hash ^ game_state_hash(&batch.instances[i])) * 1099511628211ULL;
+    }
+
+    free(actions);
+    free(action_rng);
+    batch_free(&batch);
+    jobs_free(&jobs);
+    return result;
+}
+
+static void print_result(int threads, int instances, long ticks, BatchResult result) {
+    printf("%7d  %14.0f  %10.1f  %8ld  %8ld  %10.3f  %016llx\n", threads,
+           instances * ticks / result.elapsed, result.elapsed * 1e9 / (instances * ticks),
+           result.steals, result.episodes, result.reward / instances, (unsigned long long)result.hash);
+}
+
+// 0, 1, 2, 4, ... and threads last even if it is not a power of two
+static int next_sweep_count(int count, int threads) {
+    int next = count == 0 ? 1 : count * 2;
+    return count < threads && next > threads ? threads : next;
+}
+
+int main(int argc, char **argv) {
+    int instances = 256;
+    long ticks = 2000;
+    int threads = jobs_default_threads();
+    uint64_t seed = (uint64_t)time(NULL);
+    bool sweep = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            instances = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--sweep") == 0) {
+            sweep = true;
+        } else {
+            fprintf(stderr, "usage: %s [--instances N] [--ticks T] [--threads K] [--seed N] [--sweep]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (instances < 1 || ticks < 1 || threads < 0) {
+        fprintf(stderr, "%s: --instances and --ticks must be positive, --threads at least 0\n", argv[0]);
+        return 1;
+    }
+
+    printf("seed:           %llu\n", (unsigned long long)seed);
+    printf("instances:      %d x %ld ticks, %zu bytes of state each\n", instances, ticks, sizeof(GameState));
+    printf("threads  steps/s         ns/step     steals    episodes  reward/inst  state hash\n");
+
+    if (!sweep) {
+        print_result(threads, instances, ticks, run_batch(instances, ticks, threads, seed));
+        return 0;
+    }
+
+    uint64_t hash = 0;
+    bool matched = true;
+    for (int count = 0; count <= threads; count = next_sweep_count(count, threads)) {
+        BatchResult result = run_batch(instances, ticks, count, seed);
+        print_result(count, instances, ticks, result);
+        if (count == 0) {
+            hash = result.hash;
+        }
+        matched = matched && result.hash == hash;
+    }
+    printf("result:         %s\n", matched ? "match" : "MISMATCH");
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,441 @@
+// Benchmark suite: runs scripted scenarios headlessly and reports the cost of
+// each game_step() phase per tick plus memory, as JSON.
+//
+//   ./bench [--scenario NAME] [--repeat N] [--kernel scalar|sse2|avx2]
+//           [--hitboxes mask|rect] [--threads N] [--scaling]
+//           [--json FILE] [--compare BASELINE] [--threshold PERCENT]
+//
+// Each scenario runs in its own child process so memory is per scenario. It
+// is reported in two parts: the peak once the state is set up, which is
+// mostly the fixed projectile pool (MAX_PROJECTILES slots, touched by
+// game_init()), and what the ticks add on top of that. The share of the
+// pool a scenario reached is reported too, since the pool is what it would
+// need at its own size. The fastest of --repeat runs (default 3) is
+// reported to damp noise.
+// With --compare the run fails (exit 1) if a scenario's ns per tick is more
+// than --threshold percent (default 10) above the baseline file.
+// --hitboxes rect skips the pixel mask test, to see what it costs.
+// --threads N updates and hit tests projectiles on N threads (projectile.h).
+// --scaling runs the projectile scenarios (or --scenario) on 1, 2, 4, ...
+// up to --threads (default: every core) threads, prints the speedup of
+// the projectile and collision phases, and fails if the final state
+// differs between thread counts.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "sim.h"
+#include "collision.h"
+#include "jobs.h"
+
+#define BENCH_SEED 12345
+
+typedef struct {
+    const char *name;
+    long ticks;
+    int projectiles;   // Live projectiles kept on screen during the run
+    bool out_of_reach; // Projectiles fly above the character, so every hit test scans them all
+    int hazard_types;  // Replaces hazards.cfg with this many generated types, each with waves and a ramp
+} Scenario;
+
+static const Scenario scenarios[] = {
+    {"idle", 20000, 0, false, 0},
+    {"survival", 200000, 0, false, 0},
+    {"hazards_250", 200000, 0, false, 250},
+    {"projectiles_1k", 20000, 1000, false, 0},
+    {"projectiles_100k", 200, 100000, false, 0},
+    {"projectiles_1m", 20, 1000000, false, 0},
+    {"collision_1m", 20, 1000000, true, 0},
+};
+static const int scenario_count = sizeof(scenarios) / sizeof(scenarios[0]);
+
+typedef struct {
+    long ticks;
+    double total_ns;
+    double physics_ns;     // Everything in game_step() except the four below
+    double platforms_ns;   // character_on_platform
+    double spawn_ns;       // Timer wheel: waves, score and ramps
+    double projectiles_ns; // update_projectiles
+    double collision_ns;   // check_character_collision
+    long setup_rss_kb;     // Peak resident memory once the state is set up
+    long added_rss_kb;     // What the ticks added to that peak
+    long pool_used_kb;     // Projectile pool slots up to the high water mark
+    uint64_t state_hash;   // Of the final state, equal for any thread count
+} BenchResult;
+
+static int bench_threads = 1; // Counting the one stepping the game
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Walk back and forth and jump every 0.75 s
+static InputFrame bench_input(long tick) {
+    InputFrame input = {0};
+    input.right = (tick / 600) % 2 == 0;
+    input.left = !input.right;
+    input.jump = tick % 45 == 0;
+    return input;
+}
+
+// Keep count projectiles alive, of every hazard type in turn, spread across the screen.
+// x comes from the benchmark's own stream, and so does y out of reach; in
+// reach, spawn_projectile() picks y as the game does, from its RNG_SPAWN stream.
+static void top_up_projectiles(GameState *state, Rng *rng, int count, bool out_of_reach) {
+    while (state->projectiles.count < count) {
+        int hazard = state->projectiles.count % hazards.count;
+        int x = -state->camera_x + rng_range(rng, state->width);
+        float speed = hazard_speed(&hazards.types[hazard], state->score);
+        int index = out_of_reach ? projectile_spawn(&state->projectiles, hazard, x, rng_range(rng, 60), speed)
+                                 : spawn_projectile(state, hazard, x);
+        if (index < 0) {
+            break;
+        }
+    }
+}
+
+// Many overlapping hazard types: the timer wheel's cost should not grow with them
+static void generate_hazards(int count) {
+    char *text = (char *)malloc(count * 160 + 1);
+    int length = 0;
+    for (int h = 0; h < count; h++) {
+        static const char *spawns[] = {"random", "floor", "aimed"};
+        length += sprintf(text + length, "[h%d]\nsprite %s\nspeed %d 60 10\nspawn %s\nevery %.1f\nwave %d 0.3\n"
+                                         "ramp 10 0.95 4\n",
+                          h, projectile_types[h % PROJECTILE_KIND_COUNT].name, 300 + h, spawns[h % 3],
+                          8 + (h % 50) * 0.5f, 1 + h % 4);
+    }
+    char error[256];
+    if (!hazards_parse(&hazards, text, "generated", error, sizeof(error))) {
+        fprintf(stderr, "%s\n", error);
+        exit(1);
+    }
+    free(text);
+}
+
+static BenchResult run_scenario(const Scenario *scenario) {
+    BenchResult result = {0};
+    float dt = 1.0f / SIM_TICK_RATE;
+
+    hazards_init();
+    if (scenario->hazard_types > 0) {
+        generate_hazards(scenario->hazard_types);
+    }
+
+    JobPool *jobs = NULL;
+    if (bench_threads > 1) {
+        jobs = malloc(sizeof(JobPool));
+        jobs_init(jobs, bench_threads - 1);
+        projectile_set_jobs(jobs);
+    }
+
+    GameState *state = malloc(sizeof(GameState));
+    game_init(state, 800 * scale_factor, 600 * scale_factor, BENCH_SEED);
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    result.setup_rss_kb = usage.ru_maxrss;
+    Rng rng;
+    rng_seed(&rng, BENCH_SEED, RNG_STREAM_COUNT);
+
+    bool idle = strcmp(scenario->name, "idle") == 0;
+    for (long tick = 0; tick < scenario->ticks; tick++) {
+        InputFrame input = idle ? (InputFrame){0} : bench_input(tick);
+        top_up_projectiles(state, &rng, scenario->projectiles, scenario->out_of_reach);
+
+        double t0 = now_ns();
+        step_begin(state);
+        step_physics(state, dt);
+        double t1 = now_ns();
+        step_platforms(state, input);
+        double t2 = now_ns();
+        step_movement(state, input, dt);
+        double t3 = now_ns();
+        step_spawn(state, dt);
+        double t4 = now_ns();
+        step_projectiles(state, dt);
+        double t5 = now_ns();
+        step_collision(state);
+        double t6 = now_ns();
+        step_end(state);
+        double t7 = now_ns();
+        state->game_over = false; // Hits are timed, but never end the run
+
+        result.physics_ns += (t1 - t0) + (t3 - t2) + (t7 - t6);
+        result.platforms_ns += t2 - t1;
+        result.spawn_ns += t4 - t3;
+        result.projectiles_ns += t5 - t4;
+        result.collision_ns += t6 - t5;
+    }
+
+    result.ticks = scenario->ticks;
+    result.total_ns =
+        result.physics_ns + result.platforms_ns + result.spawn_ns + result.projectiles_ns + result.collision_ns;
+
+    getrusage(RUSAGE_SELF, &usage);
+    result.added_rss_kb = usage.ru_maxrss - result.setup_rss_kb;
+    result.pool_used_kb = (long)(state->projectiles.high_water * (sizeof(ProjectilePool) / MAX_PROJECTILES) / 1024);
+    result.state_hash = game_state_hash(state);
+
+    free(state);
+    if (jobs != NULL) {
+        projectile_set_jobs(NULL);
+        jobs_free(jobs);
+        free(jobs);
+    }
+    return result;
+}
+
+// Run a scenario in a child process and collect its result through a pipe
+static int run_isolated(const Scenario *scenario, BenchResult *result) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        BenchResult child_result = run_scenario(scenario);
+        ssize_t written = write(fds[1], &child_result, sizeof(child_result));
+        _exit(written == sizeof(child_result) ? 0 : 1);
+    }
+    close(fds[1]);
+    ssize_t got = read(fds[0], result, sizeof(*result));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return (got == sizeof(*result) && WIFEXITED(status) && WEXITSTATUS(status) == 0) ? 0 : -1;
+}
+
+static void write_json(FILE *out, const Scenario *ran[], const BenchResult results[], int count) {
+    fprintf(out, "{\n  \"benchmark\": \"survive-the-jungle\",\n  \"collision_kernel\": \"%s\",\n  \"hitboxes\": \"%s\",\n"
+                 "  \"threads\": %d,\n  \"scenarios\": [\n",
+            collision_kernel_name(), collision_hitboxes_name(), bench_threads);
+    for (int i = 0; i < count; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out, "    {\"name\": \"%s\", \"ticks\": %ld, \"ns_per_tick\": %.1f, \"physics_ns\": %.1f, "
+                     "\"platforms_ns\": %.1f, \"spawn_ns\": %.1f, \"projectiles_ns\": %.1f, \"collision_ns\": %.1f, "
+                     "\"setup_rss_kb\": %ld, \"added_rss_kb\": %ld, \"pool_used_kb\": %ld}%s\n",
+                ran[i]->name, r->ticks, r->total_ns / r->ticks, r->physics_ns / r->ticks,
+                r->platforms_ns / r->ticks, r->spawn_ns / r->ticks, r->projectiles_ns / r->ticks, r->collision_ns / r->ticks,
+                r->setup_rss_kb, r->added_rss_kb, r->pool_used_kb, i + 1 < count ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+// Find "ns_per_tick" of the named scenario in a file written by write_json()
+static double baseline_ns_per_tick(const char *json, const char *name) {
+    char key[64];
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    const char *entry = strstr(json, key);
+    if (entry == NULL) {
+        return -1;
+    }
+    const char *value = strstr(entry, "\"ns_per_tick\":");
+    if (value == NULL) {
+        return -1;
+    }
+    return strtod(value + strlen("\"ns_per_tick\":"), NULL);
+}
+
+// Fastest of repeat runs, in child processes
+static int run_best(const Scenario *scenario, int repeat, BenchResult *best) {
+    for (int run = 0; run < repeat || run == 0; run++) {
+        BenchResult attempt;
+        if (run_isolated(scenario, &attempt) != 0) {
+            fprintf(stderr, "%s: scenario failed\n", scenario->name);
+            return -1;
+        }
+        if (run == 0 || attempt.total_ns < best->total_ns) {
+            *best = attempt;
+        }
+    }
+    return 0;
+}
+
+// Projectile and collision cost on 1, 2, 4, ... max_threads threads, and the
+// final state hash, which must not change with the thread count
+static int run_scaling(const char *only, int repeat, int max_threads) {
+    bool deterministic = true;
+    int ran = 0;
+    for (int i = 0; i < scenario_count; i++) {
+        const Scenario *scenario = &scenarios[i];
+        if (only != NULL ? strcmp(only, scenario->name) != 0 : scenario->projectiles <= PROJECTILE_CHUNK) {
+            continue;
+        }
+        ran++;
+        fprintf(stderr, "%s\n%8s %12s %12s %10s %8s %16s\n", scenario->name, "threads", "ns/tick", "projectiles",
+                "collision", "speedup", "state hash");
+        double single_ns = 0;
+        uint64_t single_hash = 0;
+        for (int threads = 1;; threads = threads * 2 < max_threads ? threads * 2 : max_threads) {
+            bench_threads = threads;
+            BenchResult r;
+            if (run_best(scenario, repeat, &r) != 0) {
+                return 1;
+            }
+            double parallel_ns = (r.projectiles_ns + r.collision_ns) / r.ticks;
+            if (threads == 1) {
+                single_ns = parallel_ns;
+                single_hash = r.state_hash;
+            }
+            bool same = r.state_hash == single_hash;
+            deterministic = deterministic && same;
+            fprintf(stderr, "%8d %12.1f %12.1f %10.1f %7.2fx %016llx%s\n", threads, r.total_ns / r.ticks,
+                    r.projectiles_ns / r.ticks, r.collision_ns / r.ticks, single_ns / parallel_ns,
+                    (unsigned long long)r.state_hash, same ? "" : "  DIFFERS");
+            if (threads >= max_threads) {
+                break;
+            }
+        }
+    }
+    if (ran == 0) {
+        fprintf(stderr, "no scenario named %s\n", only);
+        return 1;
+    }
+    fprintf(stderr, "deterministic across thread counts: %s\n", deterministic ? "yes" : "NO");
+    return deterministic ? 0 : 1;
+}
+
+static char *read_file(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *data = (char *)malloc(size + 1);
+    size_t got = fread(data, 1, size, file);
+    data[got] = '\0';
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv) {
+    const char *only = NULL;
+    const char *json_path = NULL;
+    const char *baseline_path = NULL;
+    double threshold = 10.0;
+    int repeat = 3;
+    int threads = 0;
+    bool scaling = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--kernel") == 0 && i + 1 < argc) {
+            collision_init();
+            if (!collision_select_kernel(argv[++i])) {
+                fprintf(stderr, "collision kernel %s is not available\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--hitboxes") == 0 && i + 1 < argc) {
+            collision_init();
+            if (!collision_select_hitboxes(argv[++i])) {
+                fprintf(stderr, "hitboxes must be mask or rect, not %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--scaling") == 0) {
+            scaling = true;
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = atof(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--scenario NAME] [--repeat N] [--kernel scalar|sse2|avx2] [--hitboxes mask|rect]\n"
+                            "       [--threads N] [--scaling] [--json FILE] [--compare BASELINE] [--threshold PERCENT]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    collision_init();
+    fprintf(stderr, "collision kernel: %s, hitboxes: %s\n", collision_kernel_name(), collision_hitboxes_name());
+    if (scaling) {
+        return run_scaling(only, repeat, threads > 0 ? threads : jobs_default_threads() + 1);
+    }
+    bench_threads = threads > 0 ? threads : 1;
+    if (bench_threads > 1) {
+        fprintf(stderr, "projectile threads: %d\n", bench_threads);
+    }
+
+    const Scenario *ran[sizeof(scenarios) / sizeof(scenarios[0])];
+    BenchResult results[sizeof(scenarios) / sizeof(scenarios[0])];
+    int count = 0;
+
+    fprintf(stderr, "%-18s %12s %10s %10s %10s %12s %10s %10s %10s %10s\n", "scenario", "ns/tick", "physics",
+            "platforms", "spawn", "projectiles", "collision", "setup KB", "added KB", "pool KB");
+    for (int i = 0; i < scenario_count; i++) {
+        if (only != NULL && strcmp(only, scenarios[i].name) != 0) {
+            continue;
+        }
+        if (run_best(&scenarios[i], repeat, &results[count]) != 0) {
+            return 1;
+        }
+        const BenchResult *r = &results[count];
+        fprintf(stderr, "%-18s %12.1f %10.1f %10.1f %10.1f %12.1f %10.1f %10ld %10ld %10ld\n", scenarios[i].name,
+                r->total_ns / r->ticks, r->physics_ns / r->ticks, r->platforms_ns / r->ticks, r->spawn_ns / r->ticks,
+                r->projectiles_ns / r->ticks, r->collision_ns / r->ticks, r->setup_rss_kb, r->added_rss_kb,
+                r->pool_used_kb);
+        ran[count++] = &scenarios[i];
+    }
+    if (count == 0) {
+        fprintf(stderr, "no scenario named %s\n", only);
+        return 1;
+    }
+
+    if (json_path != NULL) {
+        FILE *out = fopen(json_path, "w");
+        if (out == NULL) {
+            perror(json_path);
+            return 1;
+        }
+        write_json(out, ran, results, count);
+        fclose(out);
+    } else if (baseline_path == NULL) {
+        write_json(stdout, ran, results, count);
+    }
+
+    int regressions = 0;
+    if (baseline_path != NULL) {
+        char *baseline = read_file(baseline_path);
+        if (baseline == NULL) {
+            perror(baseline_path);
+            return 1;
+        }
+        for (int i = 0; i < count; i++) {
+            double current = results[i].total_ns / results[i].ticks;
+            double base = baseline_ns_per_tick(baseline, ran[i]->name);
+            if (base <= 0) {
+                fprintf(stderr, "%-18s not in baseline\n", ran[i]->name);
+                continue;
+            }
+            double change = (current - base) / base * 100.0;
+            bool regressed = change > threshold;
+            fprintf(stderr, "%-18s %10.1f -> %10.1f ns/tick (%+.1f%%)%s\n", ran[i]->name, base, current,
+                    change, regressed ? "  REGRESSION" : "");
+            regressions += regressed;
+        }
+        free(baseline);
+    }
+
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,206 @@
+// Headless simulation runner: steps the game without a window or audio device
+// and reports how fast the update loop runs.
+//
+//   ./headless [--ticks N] [--tick-rate HZ] [--input idle|walk|jump|autoplay] [--seed N] [--record FILE]
+//              [--max-mem SIZE]
+//   ./headless --replay FILE [--repeat N]
+//
+// A run that ends in game over is restarted with the next seed so every tick
+// does real work, except with --record, which stops at game over and saves
+// the run. --replay re-simulates a recording (from here or from the game's
+// --record) as fast as possible, checks it ends with the recorded score and
+// state hash, and exits 1 if not. --input autoplay lets the lookahead bot
+// play, which simulates a few hundred ticks ahead for every decision.
+// Ticks that allocated heap memory are counted, and --max-mem takes every
+// allocation from a fixed arena of SIZE bytes (mem.h) and aborts past it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "replay.h"
+#include "autoplay.h"
+#include "mem.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Scripted input so runs exercise walking, jumping and crouching
+static InputFrame scripted_input(const char *pattern, long tick) {
+    InputFrame input = {0};
+    if (strcmp(pattern, "walk") == 0) {
+        input.right = (tick / 600) % 2 == 0;
+        input.left = !input.right;
+    } else if (strcmp(pattern, "jump") == 0) {
+        input.right = (tick / 600) % 2 == 0;
+        input.left = !input.right;
+        input.jump = tick % 45 == 0;
+        input.down = tick % 90 > 80;
+    }
+    return input;
+}
+
+// Re-simulate a recording repeat times. Returns 0 if every pass matched.
+static int run_replay(const char *path, int repeat) {
+    Replay replay;
+    if (!replay_load(&replay, path)) {
+        fprintf(stderr, "%s: not a replay file\n", path);
+        return 1;
+    }
+    const ReplayHeader *header = &replay.header;
+    float dt = 1.0f / header->tick_rate;
+
+    GameState state;
+    double best = 0;
+    bool matched = true;
+    for (int pass = 0; pass < repeat || pass == 0; pass++) {
+        replay.read_pos = 0;
+        replay.read_remaining = 0;
+        game_init(&state, header->width, header->height, header->seed);
+
+        double start = now_seconds();
+        InputFrame input;
+        while (replay_next(&replay, &input)) {
+            game_step(&state, input, dt);
+        }
+        double elapsed = now_seconds() - start;
+        if (pass == 0 || elapsed < best) {
+            best = elapsed;
+        }
+        matched = matched && state.tick == header->tick_count && state.score == header->final_score &&
+                  game_state_hash(&state) == header->final_hash;
+    }
+
+    printf("replay:         %s\n", path);
+    printf("seed:           %llu\n", (unsigned long long)header->seed);
+    printf("ticks:          %u (%u bytes of input)\n", header->tick_count, header->input_size);
+    printf("ticks/s:        %.0f\n", header->tick_count / best);
+    printf("ns/tick:        %.1f\n", best * 1e9 / (header->tick_count > 0 ? header->tick_count : 1));
+    printf("score:          %d (recorded %d)\n", state.score, header->final_score);
+    printf("state hash:     %016llx (recorded %016llx)\n", (unsigned long long)game_state_hash(&state),
+           (unsigned long long)header->final_hash);
+    printf("result:         %s\n", matched ? "match" : "MISMATCH");
+
+    replay_free(&replay);
+    return matched ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+    long ticks = 100000;
+    int tick_rate = SIM_TICK_RATE;
+    const char *pattern = "jump";
+    uint64_t seed = (uint64_t)time(NULL);
+    const char *record_path = NULL;
+    const char *replay_path = NULL;
+    int repeat = 1;
+    const char *max_mem = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            tick_rate = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--input") == 0 && i + 1 < argc) {
+            pattern = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-mem") == 0 && i + 1 < argc) {
+            max_mem = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--ticks N] [--tick-rate HZ] [--input idle|walk|jump|autoplay] [--seed N] [--record FILE] [--max-mem SIZE]\n"
+                            "       %s --replay FILE [--repeat N]\n", argv[0], argv[0]);
+            return 1;
+        }
+    }
+    if (max_mem != NULL && !mem_limit_from_arg(max_mem)) {
+        return 1;
+    }
+    if (replay_path != NULL) {
+        return run_replay(replay_path, repeat);
+    }
+
+    if (tick_rate <= 0) {
+        tick_rate = SIM_TICK_RATE;
+    }
+    float dt = 1.0f / tick_rate;
+
+    GameState state;
+    game_init(&state, 800 * scale_factor, 600 * scale_factor, seed);
+
+    Replay replay;
+    replay_init(&replay, seed, tick_rate, state.width, state.height);
+
+    bool autoplay = strcmp(pattern, "autoplay") == 0;
+    static AutoPlayer bot;
+    autoplay_init(&bot, seed, dt);
+
+    int runs = 1;
+    int best_score = 0;
+    double start = now_seconds();
+    long tick;
+    long allocations = mem_allocation_count();
+    long allocating_ticks = 0; // After the first
+    for (tick = 0; tick < ticks; tick++) {
+        InputFrame input = autoplay ? autoplay_input(&bot, &state) : scripted_input(pattern, tick);
+        if (record_path != NULL) {
+            replay_record(&replay, input);
+        }
+        game_step(&state, input, dt);
+        if (tick > 0 && mem_allocation_count() != allocations) {
+            allocating_ticks++;
+        }
+        allocations = mem_allocation_count();
+        if (state.game_over && record_path != NULL) {
+            tick++;
+            break;
+        }
+        if (state.game_over) {
+            if (state.score > best_score) {
+                best_score = state.score;
+            }
+            // Each restart gets the next seed so runs differ but stay reproducible
+            game_init(&state, 800 * scale_factor, 600 * scale_factor, seed + runs);
+            runs++;
+        }
+    }
+    double elapsed = now_seconds() - start;
+    ticks = tick;
+
+    if (record_path != NULL && !replay_save(&replay, record_path, &state)) {
+        perror(record_path);
+    }
+
+    printf("seed:           %llu\n", (unsigned long long)seed);
+    printf("ticks:          %ld\n", ticks);
+    printf("elapsed:        %.3f s\n", elapsed);
+    printf("ticks/s:        %.0f\n", ticks / elapsed);
+    printf("ns/tick:        %.1f\n", elapsed * 1e9 / ticks);
+    printf("runs:           %d\n", runs);
+    printf("best score:     %d\n", state.score > best_score ? state.score : best_score);
+    printf("projectiles:    %d live, %d slots used\n", state.projectiles.count, state.projectiles.high_water);
+    printf("hazards:        %d types from %s, %d timers pending\n", hazards.count, hazards_source(), state.timers.count);
+    int resident = 0;
+    for (int c = 0; c < WORLD_CHUNK_RING; c++) {
+        resident += state.world.chunks[c].index != WORLD_NO_CHUNK;
+    }
+    printf("world:          %ld chunks generated, %d resident\n", state.world.chunks_generated, resident);
+    printf("allocating:     %ld of %ld ticks after the first\n", allocating_ticks, ticks > 0 ? ticks - 1 : 0);
+    if (autoplay) {
+        autoplay_report(&bot);
+    }
+    mem_report();
+
+    replay_free(&replay);
+    return 0;
+}
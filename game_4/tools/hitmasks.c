@@ -0,0 +1,133 @@
+// Hitmask baker: decodes the sprites the simulation collides and writes
+// their alpha channels as packed 64-bit row masks into a C source file
+// (see hitmask.h), so the simulation itself never decodes images.
+//
+//   ./hitmasks [OUTPUT]    (default hitmask_data.c, run from game_4/)
+//
+// Rerun with make bake-hitmasks whenever one of the sprites below changes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <raylib.h>
+
+#include "hitmask.h"
+
+typedef struct {
+    const char *name; // Of the enum value and the row array
+    const char *path;
+    bool mirror;      // Flipped like the left-facing sprites the game draws
+} MaskInput;
+
+static const MaskInput inputs[] = {
+    {"ARROW", "img/arrow4.png", false},
+    {"SWORD", "img/sward.png", false},
+    {"STANDING_RIGHT", "img/standing.png", false},
+    {"STANDING_LEFT", "img/standing.png", true},
+    {"WALK1_RIGHT", "img/walk1.png", false},
+    {"WALK1_LEFT", "img/walk1.png", true},
+    {"WALK2_RIGHT", "img/walk2.png", false},
+    {"WALK2_LEFT", "img/walk2.png", true},
+    {"JUMPING_RIGHT", "img/jumping.png", false},
+    {"JUMPING_LEFT", "img/jumping.png", true},
+    {"CROUCHING_RIGHT", "img/crouch2.png", false},
+    {"CROUCHING_LEFT", "img/crouch1.png", false},
+};
+static const int input_count = sizeof(inputs) / sizeof(inputs[0]);
+
+// Pack one image's alpha into rows of 64-bit words and find its solid bounds
+static uint64_t *bake(const Image *image, HitMask *mask) {
+    const unsigned char *pixels = (const unsigned char *)image->data;
+    mask->width = image->width;
+    mask->height = image->height;
+    mask->words = (image->width + 63) / 64;
+    mask->x0 = image->width;
+    mask->y0 = image->height;
+    mask->x1 = 0;
+    mask->y1 = 0;
+
+    uint64_t *rows = (uint64_t *)calloc((size_t)mask->height * mask->words, sizeof(uint64_t));
+    for (int y = 0; y < image->height; y++) {
+        for (int x = 0; x < image->width; x++) {
+            if (pixels[((size_t)y * image->width + x) * 4 + 3] < HITMASK_ALPHA_THRESHOLD) {
+                continue;
+            }
+            rows[y * mask->words + x / 64] |= 1ULL << (x % 64);
+            mask->x0 = x < mask->x0 ? x : mask->x0;
+            mask->y0 = y < mask->y0 ? y : mask->y0;
+            mask->x1 = x + 1 > mask->x1 ? x + 1 : mask->x1;
+            mask->y1 = y + 1 > mask->y1 ? y + 1 : mask->y1;
+        }
+    }
+    if (mask->x1 == 0) {
+        mask->x0 = mask->y0 = 0; // Fully transparent: empty bounds
+    }
+    return rows;
+}
+
+static void lowercase(char *out, const char *name) {
+    for (; *name != '\0'; name++) {
+        *out++ = (*name >= 'A' && *name <= 'Z') ? *name - 'A' + 'a' : *name;
+    }
+    *out = '\0';
+}
+
+int main(int argc, char **argv) {
+    const char *output = argc > 1 ? argv[1] : "hitmask_data.c";
+
+    SetTraceLogLevel(LOG_WARNING);
+    HitMask masks[sizeof(inputs) / sizeof(inputs[0])];
+    uint64_t *rows[sizeof(inputs) / sizeof(inputs[0])];
+    for (int i = 0; i < input_count; i++) {
+        Image image = LoadImage(inputs[i].path);
+        if (image.data == NULL) {
+            fprintf(stderr, "cannot load %s\n", inputs[i].path);
+            return 1;
+        }
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        if (inputs[i].mirror) {
+            ImageFlipHorizontal(&image);
+        }
+        rows[i] = bake(&image, &masks[i]);
+        UnloadImage(image);
+    }
+
+    FILE *file = fopen(output, "w");
+    if (file == NULL) {
+        perror(output);
+        return 1;
+    }
+    fprintf(file, "// Generated by tools/hitmasks.c (make bake-hitmasks) from the sprites in img/.\n"
+                  "// Do not edit; see hitmask.h for the layout.\n\n#include \"hitmask.h\"\n");
+
+    char name[64];
+    for (int i = 0; i < input_count; i++) {
+        lowercase(name, inputs[i].name);
+        fprintf(file, "\n// %s%s, %dx%d\nstatic const uint64_t %s_rows[] = {\n", inputs[i].path,
+                inputs[i].mirror ? " mirrored" : "", masks[i].width, masks[i].height, name);
+        int count = masks[i].height * masks[i].words;
+        for (int w = 0; w < count; w++) {
+            fprintf(file, "%s0x%016llxULL,%s", w % 4 == 0 ? "    " : "", (unsigned long long)rows[i][w],
+                    w % 4 == 3 || w == count - 1 ? "\n" : " ");
+        }
+        fprintf(file, "};\n");
+    }
+
+    fprintf(file, "\nconst HitMask hitmasks[HITMASK_COUNT] = {\n");
+    for (int i = 0; i < input_count; i++) {
+        const HitMask *mask = &masks[i];
+        lowercase(name, inputs[i].name);
+        fprintf(file, "    [HITMASK_%s] = {%d, %d, %d, %d, %d, %d, %d, %s_rows},\n", inputs[i].name, mask->width,
+                mask->height, mask->words, mask->x0, mask->y0, mask->x1, mask->y1, name);
+    }
+    fprintf(file, "};\n");
+    fclose(file);
+
+    printf("%s: %d masks\n", output, input_count);
+    for (int i = 0; i < input_count; i++) {
+        printf("  %-16s %4dx%-4d solid %d,%d to %d,%d\n", inputs[i].name, masks[i].width, masks[i].height,
+               masks[i].x0, masks[i].y0, masks[i].x1, masks[i].y1);
+        free(rows[i]);
+    }
+    return 0;
+}
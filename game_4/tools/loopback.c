@@ -0,0 +1,169 @@
+// Versus loopback test: two rollback peers (rollback.h) in one process,
+// talking UDP over localhost through the network conditioner, checked for
+// desyncs.
+//
+//   ./loopback [--ticks N] [--latency MS] [--jitter MS] [--loss PERCENT] [--delay TICKS]
+//              [--drift PERCENT] [--input random|autoplay] [--seed N]
+//
+// Time is simulated: each peer runs a frame every 1/60 s of a shared clock
+// (player 1's frames --drift percent longer), so latency and jitter are
+// exact and runs take no longer than their CPU time. Both peers play to
+// --ticks, then keep exchanging packets until every input is in, and must
+// end with the same state hash. Exits 1 on any desync.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rollback.h"
+#include "autoplay.h"
+
+typedef struct {
+    RollbackSession session;
+    AutoPlayer bot;
+    Rng rng;
+    uint8_t held; // Random input: keys held until the next change
+    long next_change;
+    double next_frame;
+    double frame_dt;
+} Peer;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Held keys that change every few tenths of a second, and frequent jumps:
+// enough changes that predictions go wrong often
+static InputFrame random_input(Peer *peer, long tick) {
+    if (tick >= peer->next_change) {
+        peer->held = rng_range(&peer->rng, 8);
+        peer->next_change = tick + 10 + rng_range(&peer->rng, 50);
+    }
+    InputFrame input = input_from_bits(peer->held);
+    input.jump = rng_range(&peer->rng, 30) == 0;
+    return input;
+}
+
+int main(int argc, char **argv) {
+    long ticks = 3600;
+    NetConditions conditions = {.latency_ms = 50, .jitter_ms = 10, .loss = 0.02f};
+    int delay = ROLLBACK_DEFAULT_DELAY;
+    float drift = 0;
+    bool autoplay = false;
+    uint64_t seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--latency") == 0 && i + 1 < argc) {
+            conditions.latency_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) {
+            conditions.jitter_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--loss") == 0 && i + 1 < argc) {
+            conditions.loss = atof(argv[++i]) / 100;
+        } else if (strcmp(argv[i], "--delay") == 0 && i + 1 < argc) {
+            delay = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--drift") == 0 && i + 1 < argc) {
+            drift = atof(argv[++i]) / 100;
+        } else if (strcmp(argv[i], "--input") == 0 && i + 1 < argc) {
+            autoplay = strcmp(argv[++i], "autoplay") == 0;
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--ticks N] [--latency MS] [--jitter MS] [--loss PERCENT] [--delay TICKS]\n"
+                            "       [--drift PERCENT] [--input random|autoplay] [--seed N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int width = 800 * scale_factor;
+    int height = 600 * scale_factor;
+    Peer *peers = (Peer *)calloc(2, sizeof(Peer));
+    for (int p = 0; p < 2; p++) {
+        Peer *peer = &peers[p];
+        // Player 1 starts from another seed and must take player 0's
+        rollback_init(&peer->session, p, seed + p, SIM_TICK_RATE, width, height, delay);
+        if (!net_open(&peer->session.link, 0)) {
+            perror("socket");
+            return 1;
+        }
+        net_set_conditions(&peer->session.link, conditions, seed * 2 + p);
+        autoplay_init(&peer->bot, seed + p, 1.0f / SIM_TICK_RATE);
+        rng_seed(&peer->rng, seed, RNG_STREAM_COUNT + p);
+        peer->frame_dt = 1.0 / 60 * (p == 1 ? 1 + drift : 1);
+    }
+    for (int p = 0; p < 2; p++) {
+        net_set_peer(&peers[p].session.link, "127.0.0.1", net_local_port(&peers[1 - p].session.link));
+    }
+
+    printf("conditions:     %.0f ms latency, %.0f ms jitter, %.1f%% loss, input delay %d, drift %.1f%%\n",
+           conditions.latency_ms, conditions.jitter_ms, conditions.loss * 100, delay, drift * 100);
+
+    // Play, then drain: keep polling until both have every input and agree on what is final
+    double clock = 0;
+    double start = now_seconds();
+    double drain_until = -1;
+    for (;;) {
+        Peer *peer = peers[0].next_frame <= peers[1].next_frame ? &peers[0] : &peers[1];
+        clock = peer->next_frame;
+        peer->next_frame += peer->frame_dt;
+        RollbackSession *session = &peer->session;
+        if (!rollback_poll(session, clock)) {
+            if (session->error != NULL) {
+                fprintf(stderr, "player %d: %s\n", session->local, session->error);
+                return 1;
+            }
+            if (clock > 10) {
+                fprintf(stderr, "peers never connected\n");
+                return 1;
+            }
+            continue;
+        }
+        if (session->tick < ticks) {
+            GameState *own = &session->state.players[session->local];
+            InputFrame input = autoplay && !own->game_over ? autoplay_input(&peer->bot, own)
+                                                          : random_input(peer, session->tick);
+            rollback_advance(session, input, clock);
+        }
+
+        bool done = true;
+        for (int p = 0; p < 2; p++) {
+            done = done && peers[p].session.tick == ticks && peers[p].session.confirmed == ticks;
+        }
+        if (done) {
+            break;
+        }
+        if (peers[0].session.tick == ticks && peers[1].session.tick == ticks && drain_until < 0) {
+            drain_until = clock + 5;
+        }
+        if (drain_until >= 0 && clock > drain_until) {
+            fprintf(stderr, "inputs still missing 5 s after the last tick\n");
+            return 1;
+        }
+    }
+    double elapsed = now_seconds() - start;
+
+    bool desynced = false;
+    uint64_t hashes[2];
+    for (int p = 0; p < 2; p++) {
+        printf("\n");
+        rollback_report(&peers[p].session);
+        hashes[p] = versus_hash(&peers[p].session.state);
+        desynced = desynced || peers[p].session.stats.desyncs > 0;
+    }
+    const VersusState *state = &peers[0].session.state;
+    printf("\nplayed:         %ld ticks in %.1f s of game time, %.2f s of CPU\n", ticks, clock, elapsed);
+    printf("scores:         %d and %d%s\n", state->players[0].score, state->players[1].score,
+           state->players[0].game_over && state->players[1].game_over ? ", both out" : "");
+    printf("final hash:     %016llx and %016llx\n", (unsigned long long)hashes[0], (unsigned long long)hashes[1]);
+    bool matched = hashes[0] == hashes[1] && !desynced;
+    printf("result:         %s\n", matched ? "match" : "DESYNC");
+
+    for (int p = 0; p < 2; p++) {
+        net_close(&peers[p].session.link);
+    }
+    free(peers);
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// Asset packer: decodes the game's PNGs once and writes assets.pak, which the
+// game memory-maps at startup instead of decoding PNGs (see assetpack.h).
+//
+//   ./pack [OUTPUT]        (default assets.pak, run from game_4/)
+//
+// Small sprites are packed into one atlas page with shelf packing; the
+// background and the game over screen are large enough to get a page each.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <raylib.h>
+
+#include "assetpack.h"
+
+#define ATLAS_PADDING 2 // Transparent pixels between atlas sprites, against bleeding when filtered
+#define MAX_PAGES 8
+
+typedef struct {
+    const char *name; // Name the game looks the sprite up by
+    const char *path;
+    bool own_page;
+} PackInput;
+
+static const PackInput inputs[] = {
+    {"background", "img/background.png", true},
+    {"game_over", "img/Game Over.png", true},
+    {"arrow", "img/arrow4.png", false},
+    {"sword", "img/sward.png", false},
+    {"platform1", "img/platform1.png", false},
+    {"platform2", "img/platform2.png", false},
+    {"floor", "img/floor.png", false},
+    {"standing", "img/standing.png", false},
+    {"jumping", "img/jumping.png", false},
+    {"walk1", "img/walk1.png", false},
+    {"walk2", "img/walk2.png", false},
+    {"crouch_left", "img/crouch1.png", false},
+    {"crouch_right", "img/crouch2.png", false},
+};
+static const int input_count = sizeof(inputs) / sizeof(inputs[0]);
+
+typedef struct {
+    int x;
+    int y;
+} Placement;
+
+// Place the atlas sprites left to right on shelves no wider than shelf_width,
+// tallest first. Returns the page height; the widest shelf goes to *used_width.
+static int shelf_pack(const Image images[], const int order[], int count, int shelf_width, Placement out[],
+                      int *used_width) {
+    int x = 0, y = 0, shelf_height = 0;
+    *used_width = 0;
+    for (int k = 0; k < count; k++) {
+        int i = order[k];
+        int w = images[i].width + ATLAS_PADDING;
+        int h = images[i].height + ATLAS_PADDING;
+        if (x > 0 && x + w > shelf_width) {
+            y += shelf_height;
+            x = 0;
+            shelf_height = 0;
+        }
+        out[i] = (Placement){x, y};
+        x += w;
+        if (x > *used_width) {
+            *used_width = x;
+        }
+        if (h > shelf_height) {
+            shelf_height = h;
+        }
+    }
+    return y + shelf_height;
+}
+
+static uint32_t align_up(uint32_t value) {
+    return (value + PACK_ALIGN - 1) / PACK_ALIGN * PACK_ALIGN;
+}
+
+// Copy an RGBA8 image into a page at (x, y)
+static void blit(unsigned char *page, int page_width, const Image *image, int x, int y) {
+    const unsigned char *pixels = (const unsigned char *)image->data;
+    for (int row = 0; row < image->height; row++) {
+        memcpy(page + ((size_t)(y + row) * page_width + x) * 4, pixels + (size_t)row * image->width * 4,
+               (size_t)image->width * 4);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *output = argc > 1 ? argv[1] : "assets.pak";
+
+    SetTraceLogLevel(LOG_WARNING);
+    Image images[sizeof(inputs) / sizeof(inputs[0])];
+    for (int i = 0; i < input_count; i++) {
+        images[i] = LoadImage(inputs[i].path);
+        if (images[i].data == NULL) {
+            fprintf(stderr, "cannot load %s\n", inputs[i].path);
+            return 1;
+        }
+        ImageFormat(&images[i], PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    // Atlas sprites, tallest first so each shelf wastes little height
+    int order[sizeof(inputs) / sizeof(inputs[0])];
+    int atlas_count = 0;
+    for (int i = 0; i < input_count; i++) {
+        if (!inputs[i].own_page) {
+            int k = atlas_count++;
+            while (k > 0 && images[order[k - 1]].height < images[i].height) {
+                order[k] = order[k - 1];
+                k--;
+            }
+            order[k] = i;
+        }
+    }
+
+    // Try a range of shelf widths and keep the one with the smallest page
+    Placement placements[sizeof(inputs) / sizeof(inputs[0])] = {0};
+    Placement best[sizeof(inputs) / sizeof(inputs[0])] = {0};
+    int atlas_width = 0, atlas_height = 0;
+    for (int shelf_width = 256; shelf_width <= 4096; shelf_width += 64) {
+        int used_width;
+        int height = shelf_pack(images, order, atlas_count, shelf_width, placements, &used_width);
+        if (atlas_width == 0 || (long)used_width * height < (long)atlas_width * atlas_height) {
+            atlas_width = used_width;
+            atlas_height = height;
+            memcpy(best, placements, sizeof(best));
+        }
+    }
+
+    // Pages: the atlas first, then one per large image
+    PackPage pages[MAX_PAGES] = {0};
+    PackSprite sprites[sizeof(inputs) / sizeof(inputs[0])] = {0};
+    uint32_t page_count = 1;
+    pages[0].width = atlas_width;
+    pages[0].height = atlas_height;
+    for (int i = 0; i < input_count; i++) {
+        PackSprite *sprite = &sprites[i];
+        strncpy(sprite->name, inputs[i].name, PACK_NAME_LENGTH - 1);
+        sprite->width = images[i].width;
+        sprite->height = images[i].height;
+        if (inputs[i].own_page) {
+            sprite->page = page_count;
+            pages[page_count].width = images[i].width;
+            pages[page_count].height = images[i].height;
+            page_count++;
+        } else {
+            sprite->page = 0;
+            sprite->x = best[i].x;
+            sprite->y = best[i].y;
+        }
+    }
+
+    PackHeader header = {.version = PACK_VERSION, .page_count = page_count, .sprite_count = input_count};
+    memcpy(header.magic, PACK_MAGIC, 4);
+    uint32_t offset = align_up(sizeof(header) + page_count * sizeof(PackPage) + input_count * sizeof(PackSprite));
+    for (uint32_t p = 0; p < page_count; p++) {
+        pages[p].offset = offset;
+        pages[p].size = pages[p].width * pages[p].height * 4;
+        offset = align_up(offset + pages[p].size);
+    }
+
+    FILE *file = fopen(output, "wb");
+    if (file == NULL) {
+        perror(output);
+        return 1;
+    }
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(pages, sizeof(PackPage), page_count, file);
+    fwrite(sprites, sizeof(PackSprite), input_count, file);
+
+    for (uint32_t p = 0; p < page_count; p++) {
+        unsigned char *pixels = (unsigned char *)calloc(pages[p].size, 1);
+        for (int i = 0; i < input_count; i++) {
+            if (sprites[i].page == p) {
+                blit(pixels, pages[p].width, &images[i], sprites[i].x, sprites[i].y);
+            }
+        }
+        fseek(file, pages[p].offset, SEEK_SET);
+        fwrite(pixels, 1, pages[p].size, file);
+        free(pixels);
+    }
+    fclose(file);
+
+    printf("%s: %u pages, atlas %dx%d, %u bytes\n", output, page_count, atlas_width, atlas_height, offset);
+    for (int i = 0; i < input_count; i++) {
+        UnloadImage(images[i]);
+    }
+    return 0;
+}
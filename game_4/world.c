@@ -0,0 +1,136 @@
+#include <string.h>
+
+#include "world.h"
+#include "rng.h"
+
+// Chunk containing x. Floor division, so x just left of 0 is chunk -1.
+static int32_t chunk_of(float x) {
+    int32_t chunk = (int32_t)(x / WORLD_CHUNK_WIDTH);
+    return (x < 0 && chunk * WORLD_CHUNK_WIDTH != x) ? chunk - 1 : chunk;
+}
+
+static WorldChunk *slot_of(World *world, int32_t index) {
+    int32_t slot = index % WORLD_CHUNK_RING;
+    return &world->chunks[slot < 0 ? slot + WORLD_CHUNK_RING : slot];
+}
+
+static const WorldChunk *resident_chunk(const World *world, int32_t index) {
+    const WorldChunk *chunk = slot_of((World *)world, index);
+    return chunk->index == index ? chunk : NULL;
+}
+
+// First n >= 0 with first + n * step >= x
+static int first_at_or_after(int first, int step, int x) {
+    if (x <= first) {
+        return 0;
+    }
+    return (x - first + step - 1) / step;
+}
+
+void world_init(World *world, uint64_t seed, int width, int height) {
+    memset(world, 0, sizeof(*world));
+    world->seed = seed;
+    world->floor_y = height - FLOOR_PIECE_HEIGHT + FLOOR_SPACING;
+    world->first_platform_x = (int)(width * 0.1);
+    world->platform_min_y = (int)(height * 0.2);
+    world->platform_max_y = (int)(height - FLOOR_PIECE_HEIGHT - PLATFORM_HEIGHT - world->platform_min_y);
+    for (int i = 0; i < WORLD_CHUNK_RING; i++) {
+        world->chunks[i].index = WORLD_NO_CHUNK;
+    }
+}
+
+// Build chunk index from scratch: the floor pieces and platforms whose left
+// edge falls inside it. Nothing lies left of x = 0.
+void world_generate_chunk(const World *world, int32_t index, WorldChunk *chunk) {
+    chunk->index = index;
+    chunk->platform_count = 0;
+    if (index < 0) {
+        return;
+    }
+    int chunk_x = index * WORLD_CHUNK_WIDTH;
+    int chunk_end = chunk_x + WORLD_CHUNK_WIDTH;
+
+    // Floor (Ground)
+    for (int n = first_at_or_after(0, FLOOR_PIECE_WIDTH, chunk_x); n * FLOOR_PIECE_WIDTH < chunk_end; n++) {
+        if (chunk->platform_count == MAX_CHUNK_PLATFORMS) {
+            return;
+        }
+        chunk->platforms[chunk->platform_count++] = (Platform){
+            .x = n * FLOOR_PIECE_WIDTH,
+            .y = world->floor_y,
+            .width = FLOOR_PIECE_WIDTH,
+            .height = FLOOR_PIECE_HEIGHT,
+            .type = FLOOR,
+            .number = n,
+        };
+    }
+
+    // Platforms, with heights from the chunk's own random stream
+    int step = PLATFORM_WIDTH + PLATFORM_GAP;
+    int first = first_at_or_after(world->first_platform_x, step, chunk_x);
+    int end = first_at_or_after(world->first_platform_x, step, chunk_end);
+    int count = end - first;
+    if (count > MAX_CHUNK_PLATFORMS - chunk->platform_count) {
+        count = MAX_CHUNK_PLATFORMS - chunk->platform_count;
+    }
+    float heights[MAX_CHUNK_PLATFORMS];
+    Rng random;
+    rng_seed(&random, world->seed, (uint64_t)index);
+    rng_fill_floats(&random, heights, count);
+    for (int i = 0; i < count; i++) {
+        int n = first + i;
+        chunk->platforms[chunk->platform_count++] = (Platform){
+            .x = world->first_platform_x + n * step,
+            .y = heights[i] * world->platform_max_y + world->platform_min_y,
+            .width = PLATFORM_WIDTH,
+            .height = PLATFORM_HEIGHT,
+            .type = PLATFORM,
+            .number = n,
+        };
+    }
+}
+
+// Make the chunks from one left of the view to one right of it resident, and
+// evict the rest. At most a chunk or two changes per tick while moving.
+void world_stream(World *world, float view_left, float view_right) {
+    int32_t first = chunk_of(view_left) - 1;
+    int32_t last = chunk_of(view_right) + 1;
+    if (last - first >= WORLD_CHUNK_RING) {
+        last = first + WORLD_CHUNK_RING - 1;
+    }
+
+    for (int i = 0; i < WORLD_CHUNK_RING; i++) {
+        WorldChunk *chunk = &world->chunks[i];
+        if (chunk->index != WORLD_NO_CHUNK && (chunk->index < first || chunk->index > last)) {
+            chunk->index = WORLD_NO_CHUNK;
+        }
+    }
+    for (int32_t index = first; index <= last; index++) {
+        WorldChunk *chunk = slot_of(world, index);
+        if (chunk->index != index) {
+            world_generate_chunk(world, index, chunk);
+            world->chunks_generated++;
+        }
+    }
+}
+
+// Write the resident platforms overlapping [x0, x1) on the x axis to out.
+// Returns how many were written, at most max_out. Platforms are filed in the
+// chunk of their left edge and are narrower than a chunk, so one chunk left
+// of x0 is enough.
+int world_query(const World *world, float x0, float x1, const Platform **out, int max_out) {
+    int count = 0;
+    for (int32_t index = chunk_of(x0) - 1; index <= chunk_of(x1); index++) {
+        const WorldChunk *chunk = resident_chunk(world, index);
+        if (chunk == NULL) {
+            continue;
+        }
+        for (int i = 0; i < chunk->platform_count && count < max_out; i++) {
+            const Platform *platform = &chunk->platforms[i];
+            if (platform->x < x1 && platform->x + platform->width > x0) {
+                out[count++] = platform;
+            }
+        }
+    }
+    return count;
+}
@@ -0,0 +1,63 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+// Endless world made of fixed-width chunks. Chunks around the camera live in
+// a ring buffer inside World; ones ahead are generated on demand and ones
+// behind are evicted, so memory and per-tick cost do not grow with distance.
+// A chunk depends only on the world seed and its index, so a chunk that is
+// evicted and visited again comes back the same.
+
+#include <stdint.h>
+
+#define WORLD_CHUNK_WIDTH 1024
+#define WORLD_CHUNK_RING 8
+#define MAX_CHUNK_PLATFORMS 16
+#define WORLD_NO_CHUNK INT32_MIN
+
+// Generation rules, the same as the original fixed-size world
+#define FLOOR_PIECE_WIDTH 490
+#define FLOOR_PIECE_HEIGHT 190
+#define FLOOR_SPACING 33
+#define PLATFORM_WIDTH 201
+#define PLATFORM_HEIGHT 50
+#define PLATFORM_GAP 2 // 1% of PLATFORM_WIDTH
+
+// Platforms Differ
+typedef enum {
+    PLATFORM,
+    FLOOR,
+} PlatformType;
+
+// Platform Parameters
+typedef struct Platform {
+    int x;
+    int y;
+    int width;
+    int height;
+    PlatformType type;
+    int number; // Position in the endless row of its type, picks the texture
+} Platform;
+
+typedef struct {
+    int32_t index;      // Chunk number, covering x from index * WORLD_CHUNK_WIDTH; WORLD_NO_CHUNK if empty
+    int platform_count; // Floor pieces first, then platforms, each sorted by x
+    Platform platforms[MAX_CHUNK_PLATFORMS];
+} WorldChunk;
+
+typedef struct {
+    uint64_t seed; // Chunk i draws from stream i of this seed
+    int floor_y;
+    int first_platform_x;
+    int platform_min_y;
+    int platform_max_y;
+
+    WorldChunk chunks[WORLD_CHUNK_RING]; // Chunk i lives in chunks[i mod WORLD_CHUNK_RING]
+    long chunks_generated;
+} World;
+
+void world_init(World *world, uint64_t seed, int width, int height);
+void world_generate_chunk(const World *world, int32_t index, WorldChunk *chunk);
+void world_stream(World *world, float view_left, float view_right);
+int world_query(const World *world, float x0, float x1, const Platform **out, int max_out);
+
+#endif